@@ -42,5 +42,15 @@
      */
     ref refJESP;
 
+    /** Sven Seuken and Shlomo Zilberstein, "Memory-Bounded Dynamic
+     *  Programming for DEC-POMDPs", IJCAI 2007.
+     */
+    ref refMBDP;
+
+    /** Sven Seuken and Shlomo Zilberstein, "Improved Memory-Bounded
+     *  Dynamic Programming for Decentralized POMDPs", UAI 2007.
+     */
+    ref refIMBDP;
+
 //}
 
@@ -0,0 +1,134 @@
+#include "EnemyUnitGrid.h"
+
+#include <algorithm>
+
+using namespace BWAPI;
+using namespace std;
+
+EnemyUnitGrid::EnemyUnitGrid() {
+	reset(0, 0);
+}
+
+void EnemyUnitGrid::reset(int mapWidth, int mapHeight) {
+	nrColumns = max(1, (mapWidth + EnemyUnitGrid_CellSize - 1) / EnemyUnitGrid_CellSize);
+	nrRows = max(1, (mapHeight + EnemyUnitGrid_CellSize - 1) / EnemyUnitGrid_CellSize);
+	cells.assign(nrColumns * nrRows, vector<Unit *>());
+	cellOf.clear();
+	minHealth = 0;
+}
+
+int EnemyUnitGrid::getCell(Position position) const {
+	// positions off the map are kept in the border cells
+	int column = max(0, min(position.x() / EnemyUnitGrid_CellSize, nrColumns - 1));
+	int row = max(0, min(position.y() / EnemyUnitGrid_CellSize, nrRows - 1));
+	return row * nrColumns + column;
+}
+
+void EnemyUnitGrid::removeFromCell(Unit * unit, int cell) {
+	vector<Unit *> & units = cells[cell];
+	vector<Unit *>::iterator i = find(units.begin(), units.end(), unit);
+	if (i != units.end()) {
+		*i = units.back();
+		units.pop_back();
+	}
+}
+
+void EnemyUnitGrid::add(Unit * unit) {
+	if (cellOf.find(unit) != cellOf.end())
+		return;
+
+	int cell = getCell(unit->getPosition());
+	cells[cell].push_back(unit);
+	cellOf[unit] = cell;
+	minHealth = min(minHealth, unit->getShields() + unit->getHitPoints());
+}
+
+void EnemyUnitGrid::remove(Unit * unit) {
+	map<Unit *, int>::iterator i = cellOf.find(unit);
+	if (i == cellOf.end())
+		return;
+
+	removeFromCell(unit, i->second);
+	cellOf.erase(i);
+}
+
+void EnemyUnitGrid::update() {
+	vector<Unit *> gone;
+	bool first = true;
+	for (map<Unit *, int>::iterator i = cellOf.begin(); i != cellOf.end(); i++) {
+		Unit * unit = i->first;
+		if (!unit->exists()) {
+			// in case a callback was missed
+			gone.push_back(unit);
+			continue;
+		}
+
+		int cell = getCell(unit->getPosition());
+		if (cell != i->second) {
+			removeFromCell(unit, i->second);
+			cells[cell].push_back(unit);
+			i->second = cell;
+		}
+
+		int health = unit->getShields() + unit->getHitPoints();
+		if (first || health < minHealth)
+			minHealth = health;
+		first = false;
+	}
+
+	for (vector<Unit *>::iterator i = gone.begin(); i != gone.end(); i++)
+		remove(*i);
+	if (cellOf.empty())
+		minHealth = 0;
+}
+
+Unit * EnemyUnitGrid::getClosest(Position position) const {
+	return search(position, 1.0, 0.0);
+}
+
+Unit * EnemyUnitGrid::getClosestAndWeakest(Position position, double weaknessWeight) const {
+	return search(position, 1 - weaknessWeight, weaknessWeight);
+}
+
+Unit * EnemyUnitGrid::search(Position position, double distanceWeight, double healthWeight) const {
+
+	Unit * best = NULL;
+	double bestScore = 0;
+	if (cellOf.empty())
+		return best;
+
+	int cell = getCell(position);
+	int column = cell % nrColumns;
+	int row = cell / nrColumns;
+	int maxRing = max(max(column, nrColumns - 1 - column), max(row, nrRows - 1 - row));
+
+	// visit the square rings of cells around the cell of position; no unit
+	// in ring r is closer than r-1 cells, which bounds the score of the ring
+	for (int r = 0; r <= maxRing; r++) {
+		double bound = distanceWeight * max(0, r - 1) * EnemyUnitGrid_CellSize + healthWeight * minHealth;
+		if (best != NULL && bound > bestScore)
+			break;
+
+		for (int y = max(0, row - r); y <= min(nrRows - 1, row + r); y++) {
+			// only the first and last row of the ring are complete
+			int step = (y == row - r || y == row + r) ? 1 : 2 * r;
+			for (int x = column - r; x <= column + r; x += max(1, step)) {
+				if (x < 0 || x >= nrColumns)
+					continue;
+
+				const vector<Unit *> & units = cells[y * nrColumns + x];
+				for (vector<Unit *>::const_iterator i = units.begin(); i != units.end(); i++) {
+					double score = distanceWeight * position.getDistance((*i)->getPosition()) +
+						healthWeight * ((*i)->getShields() + (*i)->getHitPoints());
+					// ties go to the lowest address, as in a std::set<Unit*>
+					if (best == NULL || score < bestScore || (score == bestScore && *i < best)) {
+						best = *i;
+						bestScore = score;
+					}
+				}
+			}
+		}
+	}
+
+	return best;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <BWAPI.h>
+
+#include <vector>
+#include <map>
+
+// side of a grid cell in pixels (8 build tiles)
+#define EnemyUnitGrid_CellSize 256
+
+// EnemyUnitGrid is a uniform grid over the map that holds the visible
+// enemy units, so that the closest (or closest and weakest) enemy of a
+// unit can be found by only looking at the cells around it.
+//
+// The set of units is maintained incrementally through add() and
+// remove(), called from the unit show/hide/destroy callbacks. Since
+// units move, update() has to be called once per frame to move units
+// to their current cell; this is linear in the number of enemy units,
+// instead of the number of own units times enemy units.
+class EnemyUnitGrid {
+public:
+	EnemyUnitGrid();
+
+	// clears the grid, and sizes it for a map of the given size in pixels
+	void reset(int mapWidth, int mapHeight);
+
+	void add(BWAPI::Unit * unit);
+	void remove(BWAPI::Unit * unit);
+	void update();
+
+	int size() const { return (int) cellOf.size(); }
+
+	// the enemy closest to position, or NULL if there is none
+	BWAPI::Unit * getClosest(BWAPI::Position position) const;
+	// the enemy minimizing (1-weaknessWeight)*distance + weaknessWeight*health
+	BWAPI::Unit * getClosestAndWeakest(BWAPI::Position position, double weaknessWeight) const;
+
+protected:
+	int nrColumns, nrRows;
+	std::vector<std::vector<BWAPI::Unit *> > cells;
+	// the cell each unit is stored in
+	std::map<BWAPI::Unit *, int> cellOf;
+	// the lowest health (shields plus hit points) of any unit, as of update()
+	int minHealth;
+
+	int getCell(BWAPI::Position position) const;
+	void removeFromCell(BWAPI::Unit * unit, int cell);
+	BWAPI::Unit * search(BWAPI::Position position, double distanceWeight, double healthWeight) const;
+};
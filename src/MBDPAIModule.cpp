@@ -3,6 +3,7 @@
 #include "SimulationDecPOMDPDiscrete.h"
 #include "SimulationResult.h"
 #include "PolicyPureVector.h"
+#include "PolicyCache.h"
 
 #include "argumentHandlers.h"
 #include "argumentUtils.h"
@@ -13,12 +14,31 @@
 #include <iostream>
 #include <vector>
 #include <sstream>
+#include <fstream>
 
 using namespace BWAPI;
 using namespace std;
 
 MBDPAIModule::MBDPAIModule() {
 	initFinished = false;
+	havePolicy = false;
+	planningThread = NULL;
+	stopPlanning = CreateEvent(NULL, TRUE, FALSE, NULL);
+	InitializeCriticalSection(&pendingLock);
+	pendingPolicy = NULL;
+	pendingHorizon = 0;
+}
+
+MBDPAIModule::~MBDPAIModule() {
+	// the planning service uses this module, so it has to be stopped first
+	if (planningThread != NULL) {
+		SetEvent(stopPlanning);
+		WaitForSingleObject(planningThread, INFINITE);
+		CloseHandle(planningThread);
+	}
+	CloseHandle(stopPlanning);
+	DeleteCriticalSection(&pendingLock);
+	delete pendingPolicy;
 }
 
 void MBDPAIModule::onStart()
@@ -48,40 +68,48 @@ void MBDPAIModule::onStart()
       Broodwar->self()->getRace().getName().c_str(),
       Broodwar->enemy()->getRace().getName().c_str());
 
-	// Initialize planner
+	// index the enemy units that are already visible, the unit
+	// callbacks keep the index up to date from here on
+	enemies.reset(Broodwar->mapWidth() * 32, Broodwar->mapHeight() * 32);
+	for (std::set<Player *>::const_iterator iter = Broodwar->getPlayers().begin(); iter != Broodwar->getPlayers().end(); iter++) {
+		if ((*iter)->isEnemy(Broodwar->self())) {
+			for (std::set<Unit *>::const_iterator unititer = (*iter)->getUnits().begin(); unititer != (*iter)->getUnits().end(); unititer ++) {
+				enemies.add(*unititer);
+			}
+		}
+	}
 
-	ArgumentHandlers::Arguments args;
-//	args.infiniteHorizon = 1;
-	args.horizon = 5;
-	args.dpf = "D:/demo.dpomdp";
-//	args.problem_type = ProblemType::DT;
-	DecPOMDPDiscreteInterface & decpomdp = * ArgumentUtils::GetDecPOMDPDiscreteInterfaceFromArgs(args);
-    
-    //Initialization of the planner with typical options for JESP:
-    PlanningUnitMADPDiscreteParameters params;
-    params.SetComputeAll(true);
-    params.SetComputeJointActionObservationHistories(false);
-    params.SetComputeJointObservationHistories(false);
-    params.SetComputeJointBeliefs(false);
-    if(args.sparse)
-        params.SetUseSparseJointBeliefs(true);
-    else
-        params.SetUseSparseJointBeliefs(false);
-
-    planner = new JESPDynamicProgrammingPlanner (params,args.horizon,&decpomdp);
-
-	planner->Plan();
-	JointPolicyPureVector * jp = planner->GetJointPolicyPureVector();
-
-	parsePolicy(jp->SoftPrint());
+	// start from the policy cached by an earlier game, if any; units
+	// just attack until the planning service delivers a policy
+	ifstream cached(MBDPAIModule_AutomatonFile);
+	if (cached) {
+		cached.close();
+		try {
+			PolicyAutomaton cachedPolicy;
+			cachedPolicy.Load(MBDPAIModule_AutomatonFile);
+			usePolicy(cachedPolicy);
+			Broodwar->printf("Loaded policy from %s", MBDPAIModule_AutomatonFile);
+		} catch (E & e) {
+			Broodwar->printf("Ignoring cached policy: %s", e.SoftPrint().c_str());
+		}
+	}
+
+	// planning happens in the background, so it never delays the game
+	planningThread = CreateThread(NULL, 0, AnalyzeThread, this, 0, NULL);
 
 	initFinished = true;
 
-	Broodwar->printf("JESP planner initialized"); 
+	Broodwar->printf("JESP planning service started"); 
   }
 }
 void MBDPAIModule::onEnd(bool isWinner)
 {
+  // a running JESP plan cannot be interrupted, so don't wait for it long
+  if (planningThread != NULL)
+  {
+    SetEvent(stopPlanning);
+    WaitForSingleObject(planningThread, MBDPAIModule_StopTimeoutMs);
+  }
   if (isWinner)
   {
     //log win to file
@@ -113,6 +141,13 @@ void MBDPAIModule::onFrame()
 	if (Broodwar->isReplay())
 		return;
 
+	// no unit is in the middle of an order decision here, so this is
+	// where a new policy of the planning service can be swapped in
+	swapInPolicy();
+
+	// enemy units have moved since the last frame
+	enemies.update();
+
 	// perform observations, update state variables
 	// right now we only observe our own units
 
@@ -163,45 +198,22 @@ void MBDPAIModule::onFrame()
 			continue;
 		}
 
-		// **** need to keep track of where in the policy tree the agent is, rather than always starting at the root!
-		PolicyTreeNode * root;
-
-		if (unitObs->lastPolicyTreeNode != NULL) {
-			root = unitObs->lastPolicyTreeNode;
-		} else {
-			map<int, PolicyTreeNode *>::iterator iter = policyTree.find(unitcounter % policyTree.size());
-			if (iter == policyTree.end()) {
-				// can't find this unit anywhere!
-				unitcounter ++;
-				continue;
-			}
-			root = (*iter).second;
-		}
-
-
-		map<string, PolicyTreeNode *>::iterator iter2;
-		if (unitObs->attackedEventDate > clock()) {
-			iter2 = root->children.find("B");
-		} else {
-			iter2 = root->children.find("NB");
-		}
-
-		if (iter2 == root->children.end()) {
-			// couldn't find a child node, must be at a leaf
-			map<int, PolicyTreeNode *>::iterator iter = policyTree.find(unitcounter % policyTree.size());
-			if (iter == policyTree.end()) {
-				// can't find this unit anywhere!
-				unitcounter ++;
-				continue;
+		// advance the unit's agent through its policy automaton
+		Index node = 0;
+		bool fleeAction = false;
+		if (havePolicy) {
+			if (unitObs->lastNode < 0) {
+				unitObs->agent = unitcounter % policy.GetNrAgents();
+				unitObs->lastNode = PolicyAutomaton::GetRootNode();
 			}
-			root = (*iter).second;
-		} else {
 
-			root = (*iter2).second;
+			Index o = unitObs->attackedEventDate > clock() ?
+				obsAttacked[unitObs->agent] : obsNotAttacked[unitObs->agent];
+			node = policy.GetSuccessor(unitObs->agent, unitObs->lastNode, o);
+			fleeAction = policy.GetAction(unitObs->agent, node) == actionFlee[unitObs->agent];
 		}
 
-
-		if (root->action == "E"){
+		if (fleeAction){
 			// gonna map this to a flee
 
 			// if the unit is already fleeing, then don't change
@@ -228,7 +240,8 @@ void MBDPAIModule::onFrame()
 
 		} 
 
-		unitObs->lastPolicyTreeNode = root;
+		if (havePolicy)
+			unitObs->lastNode = node;
 
 		unitcounter ++;
 	} 
@@ -244,6 +257,7 @@ void MBDPAIModule::onUnitDestroy(BWAPI::Unit* unit)
   if (!Broodwar->isReplay())
     Broodwar->sendText("A %s [%x] has been destroyed at (%d,%d)",unit->getType().getName().c_str(),unit,unit->getPosition().x(),unit->getPosition().y());
 
+  enemies.remove(unit);
 }
 
 void MBDPAIModule::onUnitMorph(BWAPI::Unit* unit)
@@ -252,12 +266,19 @@ void MBDPAIModule::onUnitMorph(BWAPI::Unit* unit)
 }
 void MBDPAIModule::onUnitShow(BWAPI::Unit* unit)
 {
+  if (isEnemy(unit))
+    enemies.add(unit);
 }
 void MBDPAIModule::onUnitHide(BWAPI::Unit* unit)
 {
+  enemies.remove(unit);
 }
 void MBDPAIModule::onUnitRenegade(BWAPI::Unit* unit)
 {
+  // the unit changed owner
+  enemies.remove(unit);
+  if (isEnemy(unit))
+    enemies.add(unit);
 }
 void MBDPAIModule::onPlayerLeft(BWAPI::Player* player)
 {
@@ -334,50 +355,21 @@ void MBDPAIModule::showForces()
     }
   }
 }
+bool MBDPAIModule::isEnemy(BWAPI::Unit * unit) {
+	return unit->getPlayer() != NULL && unit->getPlayer()->isEnemy(Broodwar->self());
+}
+
 BWAPI::Unit * MBDPAIModule::getClosestEnemy(BWAPI::Unit * unit) {
 
 	// find the closest unit to me
-	double closestDistance = 1000000000;
-	BWAPI::Unit * closestUnit = NULL;
-
-    // pick a visible enemy
-	  for (std::set<Player *>::const_iterator iter = Broodwar->getPlayers().begin(); iter != Broodwar->getPlayers().end(); iter++) {
-		  if ((*iter)->isEnemy(Broodwar->self())) {
-			  for (std::set<Unit *>::const_iterator unititer = (*iter)->getUnits().begin(); unititer != (*iter)->getUnits().end(); unititer ++) {
-				  double distance = unit->getPosition().getDistance((*unititer)->getPosition());
-				  if (distance < closestDistance) {
-					 closestDistance = distance;
-					 closestUnit = *unititer;
-				  }
-			  }
-		  }
-	  }
-	return closestUnit;
+	return enemies.getClosest(unit->getPosition());
 }
 
 BWAPI::Unit * MBDPAIModule::getClosestAndWeakestEnemy(BWAPI::Unit * unit) {
 
 	double weaknessWeight = 0.5;
 
-	// find the closest unit to me
-	double closestDistance = 1000000000;
-	BWAPI::Unit * closestUnit = NULL;
-
-    // pick a visible enemy
-	  for (std::set<Player *>::const_iterator iter = Broodwar->getPlayers().begin(); iter != Broodwar->getPlayers().end(); iter++) {
-		  if ((*iter)->isEnemy(Broodwar->self())) {
-			  for (std::set<Unit *>::const_iterator unititer = (*iter)->getUnits().begin(); unititer != (*iter)->getUnits().end(); unititer ++) {
-				  double distance = unit->getPosition().getDistance((*unititer)->getPosition());
-				  distance *= (1- weaknessWeight);
-				  distance += weaknessWeight * ((*unititer)->getShields() + (*unititer)->getHitPoints());
-				  if (distance < closestDistance) {
-					 closestDistance = distance;
-					 closestUnit = *unititer;
-				  }
-			  }
-		  }
-	  }
-	return closestUnit;
+	return enemies.getClosestAndWeakest(unit->getPosition(), weaknessWeight);
 }
 
 void MBDPAIModule::Explore(BWAPI::Unit * explorer) {
@@ -443,82 +435,113 @@ bool MBDPAIModule::isAttacking(BWAPI::Unit *unit) {
 	return unitObservations[unit->getID()]->lastOrder == UnitObservation::Attack;
 }
 
-void MBDPAIModule::parsePolicy(string &policy) {
-
-	int agentCounter = 0;
-	stringstream tempstr;
-	
-	tempstr << agentCounter;
-	int curPos = policy.find(string("Policy for agent ") + tempstr.str());
-	tempstr.str("");
-
-	while (curPos >= 0 && curPos < policy.length()) {
-
-		PolicyTreeNode * agentRoot = new PolicyTreeNode();
-
-		tempstr << (agentCounter +1);
-		int nextAgent = policy.find(string("Policy for agent ") + tempstr.str());
-		tempstr.str("");
-
-		if (nextAgent < 0)
-			nextAgent = policy.length();
-
-		// read in first action, set it as agentRoot's action
-
-		int actionStart = policy.find(string("-->"), curPos) + 4;
-		agentRoot->action = policy.substr(actionStart,policy.find(string("\n"), actionStart) - actionStart);
-
-		curPos = policy.find(string(","), actionStart);
-		// for each of the following lines (until the next agent's policy) create a new policyTreeNode
-		// add it by following the observation list one by one, starting at agent root, then add the node where it ends
-		
-		while (curPos >0 && curPos < nextAgent) {
-			// found new policy Node
-
-			PolicyTreeNode * cur = agentRoot;
-
-			PolicyTreeNode * newNode = new PolicyTreeNode();
-
-			actionStart = policy.find(string("-->"), curPos) + 4;
-
-			string obsString;
+DWORD WINAPI AnalyzeThread(LPVOID module) {
+	static_cast<MBDPAIModule *>(module)->planLoop();
+	return 0;
+}
 
-			while (curPos > 0 && curPos < actionStart) {
+void MBDPAIModule::planLoop() {
+	// runs on the planning thread: it may not touch Broodwar, and only
+	// communicates through pendingPolicy
+	ArgumentHandlers::Arguments args;
+	args.dpf = MBDPAIModule_ProblemFile;
+	DecPOMDPDiscreteInterface * decpomdp = NULL;
+
+	try {
+		decpomdp = ArgumentUtils::GetDecPOMDPDiscreteInterfaceFromArgs(args);
+		// shared by all bots, so a policy is planned only once
+		PolicyCache cache;
+
+		for (int h = MBDPAIModule_InitialHorizon; h <= MBDPAIModule_MaxHorizon; h++) {
+			//Initialization of the planner with typical options for JESP:
+			PlanningUnitMADPDiscreteParameters params;
+			params.SetComputeAll(true);
+			params.SetComputeJointActionObservationHistories(false);
+			params.SetComputeJointObservationHistories(false);
+			params.SetComputeJointBeliefs(false);
+			if(args.sparse)
+				params.SetUseSparseJointBeliefs(true);
+			else
+				params.SetUseSparseJointBeliefs(false);
+
+			JESPDynamicProgrammingPlanner planner(params, h, decpomdp);
+			stringstream settings;
+			settings << "JESP " << JESPtype::JESPDP << " h=" << h
+				<< " restarts=" << planner.GetNrRestarts();
+			string key = PolicyCache::GetKey(*decpomdp, settings.str());
+			double value;
+			if (!cache.LoadJointPolicy(key, *planner.GetJointPolicyPureVector(), value)) {
+				planner.Plan();
+				cache.SaveJointPolicy(key, *planner.GetJointPolicyPureVector(), planner.GetExpectedReward());
+			}
+			PolicyAutomaton * newPolicy =
+				new PolicyAutomaton(*planner.GetJointPolicyPureVector(), planner);
+
+			// cache it for the next game, which then starts with it
+			try {
+				newPolicy->Save(MBDPAIModule_AutomatonFile);
+			} catch (E & e) {
+				e.Print();
+			}
 
-				// extract everything between the commas
-				int comma = policy.find(string(","), curPos + 2);
-				obsString = policy.substr(curPos + 2, comma - curPos -2);
+			EnterCriticalSection(&pendingLock);
+			delete pendingPolicy;
+			pendingPolicy = newPolicy;
+			pendingHorizon = h;
+			LeaveCriticalSection(&pendingLock);
 
-				curPos = comma;
+			if (h == MBDPAIModule_MaxHorizon ||
+				WaitForSingleObject(stopPlanning, MBDPAIModule_ReplanIntervalMs) != WAIT_TIMEOUT)
+				break;
+		}
+	} catch (E & e) {
+		// keep executing the last policy
+		e.Print();
+	}
 
-				// if the next comma is after actionStart then break
-				int nextComma = policy.find(string(","), comma + 2);
-				if (nextComma >= actionStart || nextComma < 0)
-					break;
+	delete decpomdp;
+}
 
-				// move cur down through the policyTree given the observation we just read in
-				map<string, PolicyTreeNode *>::iterator iter = cur->children.find(obsString);
-				if (iter == cur->children.end()) {
-					// error, can't find observation
-				} else {
-					cur = iter->second;
-				}
-			}
+void MBDPAIModule::swapInPolicy() {
 
-			newNode->action = policy.substr(actionStart,policy.find(string("\n"), actionStart) - actionStart);
-			cur->children[obsString] = newNode;
-			if (curPos < 0) break;
+	EnterCriticalSection(&pendingLock);
+	PolicyAutomaton * newPolicy = pendingPolicy;
+	int horizon = pendingHorizon;
+	pendingPolicy = NULL;
+	LeaveCriticalSection(&pendingLock);
 
-			curPos = policy.find(string(","), curPos + 2);
-		}
+	if (newPolicy == NULL)
+		return;
 
+	try {
+		usePolicy(*newPolicy);
+		Broodwar->printf("Switched to the JESP policy for horizon %d", horizon);
+	} catch (E & e) {
+		Broodwar->printf("Ignoring new policy: %s", e.SoftPrint().c_str());
+	}
+	delete newPolicy;
+}
 
-		policyTree[agentCounter] = agentRoot;
+void MBDPAIModule::usePolicy(const PolicyAutomaton & newPolicy) {
 
-		agentCounter ++;
-		curPos = nextAgent;
+	// map the named events of the bot to indices once; this throws
+	// before anything changes if the policy doesn't fit the bot
+	vector<Index> newObsAttacked, newObsNotAttacked, newActionFlee;
+	for (Index agentI = 0; agentI < newPolicy.GetNrAgents(); agentI++) {
+		newObsAttacked.push_back(newPolicy.GetObservationIndex(agentI, "B"));
+		newObsNotAttacked.push_back(newPolicy.GetObservationIndex(agentI, "NB"));
+		newActionFlee.push_back(newPolicy.GetActionIndex(agentI, "E"));
+	}
 
+	policy = newPolicy;
+	obsAttacked.swap(newObsAttacked);
+	obsNotAttacked.swap(newObsNotAttacked);
+	actionFlee.swap(newActionFlee);
+	havePolicy = true;
 
+	// node ids of the old policy mean nothing in the new one
+	for (map<int, UnitObservation *>::iterator i = unitObservations.begin(); i != unitObservations.end(); i++) {
+		i->second->agent = -1;
+		i->second->lastNode = -1;
 	}
-
-}
\ No newline at end of file
+}
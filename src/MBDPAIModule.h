@@ -3,22 +3,30 @@
 #include <windows.h>
 
 #include "SimulationDecPOMDPDiscrete.h"
+#include "PolicyAutomaton.h"
+#include "EnemyUnitGrid.h"
 #include <time.h>
 
 #include <vector>
 #include <set>
 #include <map>
 
-DWORD WINAPI AnalyzeThread();
+// the planning service, runs MBDPAIModule::planLoop() of the module passed
+DWORD WINAPI AnalyzeThread(LPVOID module);
 
 #define ATTACK_STATE_LASTS_MS CLOCKS_PER_SEC
 
-class PolicyTreeNode {
-public:
-	std::string action;
-	std::map<std::string, PolicyTreeNode *> children;
+// the problem to plan for, and where its compiled policy is cached
+#define MBDPAIModule_ProblemFile "D:/demo.dpomdp"
+#define MBDPAIModule_AutomatonFile "D:/demo.policyautomaton"
 
-};
+// the planning service first plans for the initial horizon, and then
+// replans with a horizon one larger after each interval, up to the maximum
+#define MBDPAIModule_InitialHorizon 5
+#define MBDPAIModule_MaxHorizon 8
+#define MBDPAIModule_ReplanIntervalMs 30000
+// how long onEnd() waits for a planning run to finish
+#define MBDPAIModule_StopTimeoutMs 1000
 
 class UnitObservation {
 public:
@@ -33,7 +41,8 @@ public:
 		lastOrder = Idle;
 		attackedEventDate = 0;
 		lastHealth = -1;
-		lastPolicyTreeNode = NULL;
+		agent = -1;
+		lastNode = -1;
 		lastTarget = NULL;
 	}
 
@@ -41,13 +50,15 @@ public:
 	BWAPI::Unit * lastTarget;
 	clock_t attackedEventDate; // if in the past, unit is not under attack
 	int lastHealth;
-	PolicyTreeNode * lastPolicyTreeNode;
+	int agent; // the agent whose policy this unit follows
+	int lastNode; // node in the policy automaton, -1 if not started
 };
 
 class MBDPAIModule : public BWAPI::AIModule
 {
 public:
   MBDPAIModule();
+  virtual ~MBDPAIModule();
   virtual void onStart();
   virtual void onEnd(bool isWinner);
   virtual void onFrame();
@@ -68,13 +79,16 @@ protected:
 	BWAPI::Unit * getClosestEnemy(BWAPI::Unit * unit);
 	BWAPI::Unit * getClosestAndWeakestEnemy(BWAPI::Unit * unit);
 
+	bool isEnemy(BWAPI::Unit * unit);
+	// the visible enemy units, for the two queries above
+	EnemyUnitGrid enemies;
+
   void drawStats();
   void showPlayers();
   void showForces();
   
   bool show_visibility_data;
 
-  PlanningUnitDecPOMDPDiscrete* planner;
   bool initFinished;
 
   std::map<int, UnitObservation *> unitObservations;
@@ -84,8 +98,22 @@ protected:
   bool isAttacking(BWAPI::Unit * unit);
   void MBDPAIModule::AttackUnit(BWAPI::Unit * attacker, BWAPI::Unit * target);
 
-  void parsePolicy(std::string & policyStr);
-
-  std::map<int, PolicyTreeNode *> policyTree;
-
-};
\ No newline at end of file
+  friend DWORD WINAPI AnalyzeThread(LPVOID module);
+  void planLoop();
+  void usePolicy(const PolicyAutomaton & newPolicy);
+  void swapInPolicy();
+
+  // the policy that is executed, only valid if havePolicy
+  PolicyAutomaton policy;
+  bool havePolicy;
+  // per agent, the indices of the "B", "NB" observations and "E" action
+  std::vector<Index> obsAttacked, obsNotAttacked, actionFlee;
+
+  HANDLE planningThread;
+  HANDLE stopPlanning; // event, signalled when the game ends
+  CRITICAL_SECTION pendingLock;
+  // the latest policy of the planning service, guarded by pendingLock
+  PolicyAutomaton * pendingPolicy;
+  int pendingHorizon;
+
+};
\ No newline at end of file
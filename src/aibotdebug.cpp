@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include "BWAPI.h"
 #include "stdarg.h"
+#include <stdlib.h>
+#include <time.h>
 
 #include <list>
 #include <map>
@@ -26,12 +28,20 @@
 using namespace BWAPI;
 
 class TestUnit : public BWAPI::Unit {
+private:
+	int id;
+	Player * player;
+	Position position;
+	int hitPoints;
 public:
+	TestUnit(int id = 0, Player * player = NULL, Position position = BWAPI::Positions::None, int hitPoints = 0) :
+		id(id), player(player), position(position), hitPoints(hitPoints) {}
+
 	int getID() const{
-		return 0;
+		return id;
 	}
 	Player* getPlayer() const {
-		return NULL;
+		return player;
 	}
 	UnitType getType() const {
 		return BWAPI::UnitTypes::None;
@@ -40,7 +50,7 @@ public:
 		return BWAPI::UnitTypes::None;
 	}
        int getHitPoints() const{
-		return 0;
+		return hitPoints;
 	}
        int getInitialHitPoints() const {
 		return 0;
@@ -102,7 +112,7 @@ public:
 	}
 
        Position getPosition() const {
-		   return BWAPI::Positions::None;
+		   return position;
 	}
        Position getInitialPosition() const {
 		   return BWAPI::Positions::None;
@@ -301,6 +311,9 @@ class TestPlayer : public BWAPI::Player {
 private:
 	std::set<Unit*> unitSet;
 public:
+	void addUnit(Unit * unit) {
+		unitSet.insert(unit);
+	}
 	int getID() const {
 		return 0;
 	}
@@ -323,7 +336,7 @@ public:
 		return true;
 	}
        bool isEnemy(Player* player) const {
-		return true;
+		return player != this;
 	}
        bool isNeutral() const{
 		return false;
@@ -402,15 +415,27 @@ public:
 class TestGame : public BWAPI::Game {
 private:
 	TestPlayer * player;
+	TestPlayer * enemyPlayer;
+	std::set<Player *> players;
     public :
 		TestGame() {
 			player = new TestPlayer();
+			enemyPlayer = new TestPlayer();
+			players.insert(player);
+			players.insert(enemyPlayer);
+		}
+		// gives both players nrUnits units at random positions
+		void addUnits(int nrUnits) {
+			for (int i = 0; i < nrUnits; i++) {
+				player->addUnit(new TestUnit(2 * i, player, Position(rand() % (mapWidth() * 32), rand() % (mapHeight() * 32)), 40));
+				enemyPlayer->addUnit(new TestUnit(2 * i + 1, enemyPlayer, Position(rand() % (mapWidth() * 32), rand() % (mapHeight() * 32)), 20 + rand() % 60));
+			}
 		}
 		std::set< Force* >& getForces() {
 			return *(new std::set<Force *>);
 		}
 		std::set< Player* >& getPlayers() {
-			return *(new std::set<Player *>);
+			return players;
 		}
 		std::set< Unit* >& getAllUnits(){
 			return *(new std::set<Unit*>);
@@ -488,10 +513,10 @@ private:
 	   }
 
        int mapWidth(){
-		   return 0;
+		   return 128;
 	   }
        int mapHeight(){
-		   return 0;
+		   return 128;
 	   }
        std::string mapFilename(){
 		   return std::string("");
@@ -582,7 +607,7 @@ private:
 		   return player;
 	   }
 	   Player* enemy() {
-			return player;
+			return enemyPlayer;
 	   }
 
 	   void drawText(int ctype, int x, int y, const char* text, ...) {
@@ -673,18 +698,26 @@ int main(int argc, char **argv)
 
 	// Call function.
 
-	BWAPI::Game * testGame = new TestGame();
+	// usage: aibotdebug [units per player] [frames], for benchmarking onFrame()
+	int nrUnits = argc > 1 ? atoi(argv[1]) : 0;
+	int nrFrames = argc > 2 ? atoi(argv[2]) : 1000;
+
+	TestGame * testGame = new TestGame();
+	testGame->addUnits(nrUnits);
 
 	testModule = createAIModule(testGame);
  
 	testModule->onStart();
 
-	for (int i = 0; i < 1000; i ++) {
+	clock_t start = clock();
+	for (int i = 0; i < nrFrames; i ++) {
 		testModule->onFrame();
 	}
+	printf("%d frames with %d units per player: %f ms per frame\n", nrFrames, nrUnits,
+		1000.0 * (clock() - start) / CLOCKS_PER_SEC / (nrFrames > 0 ? nrFrames : 1));
 
 	// Unload DLL file
 	FreeLibrary(hinstLib);
  
 	return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -35,6 +35,14 @@
 #include "versions.h"
 #include <limits.h>
 
+/// Whether large tables of values are stored in single precision.
+/** Defaults to 0 (double). Building everything with
+ * -DMADP_FLOAT_PRECISION=1 (see PRECISION_FLAGS in Makefile.custom)
+ * stores them as float, see Globals::Scalar. */
+#ifndef MADP_FLOAT_PRECISION
+#define MADP_FLOAT_PRECISION 0
+#endif
+
 /// Globals contains several definitions global to the MADP toolbox.
 namespace Globals {
 
@@ -45,6 +53,18 @@ typedef unsigned int Index;
 /// A long long index.
 typedef unsigned long long int LIndex;
 
+/// The scalar type in which large tables of values are stored.
+/** This concerns alpha vectors, vector sets, Q-tables and reward
+ * (utility) tables. It is float when MADP_FLOAT_PRECISION is 1, which
+ * halves their memory footprint and bandwidth. Computations on these
+ * tables (inner products, backups) still accumulate in double, and
+ * beliefs are always stored as double. */
+#if MADP_FLOAT_PRECISION
+typedef float Scalar;
+#else
+typedef double Scalar;
+#endif
+
 /* constants */
 
 /// The highest horizon we will consider.
@@ -283,6 +283,17 @@ const Index* IndexTools::JointToIndividualIndicesArrayStepSize(Index jointI,
     }
     return(resultArr);
 }
+void IndexTools::JointToIndividualIndicesArrayStepSize(Index jointI, 
+            const size_t * step_size, size_t vec_size, Index * indices )
+{
+    Index remainder = jointI;
+    for(Index i=0; i < vec_size ; i++)
+    {
+        Index aI = remainder / step_size[i];
+        indices[i] = aI;//store this indiv. index
+        remainder -= step_size[i] * aI;
+    }
+}
 size_t * IndexTools::CalculateStepSize(const vector<size_t>& nrElems)
 {
     size_t vec_size = nrElems.size();
@@ -95,6 +95,14 @@ namespace IndexTools {
      * freed.*/
     const Index * JointToIndividualIndicesArrayStepSize(Index jointI, 
             const size_t * stepSize, size_t vec_size ) ;
+    /** \brief The reverse of IndividualToJointIndices - taking the
+     * stepSize array as an argument and writing the result to the
+     * array indices.
+     *
+     * indices should have room for vec_size entries, so it can be
+     * allocated on the stack by the caller.*/
+    void JointToIndividualIndicesArrayStepSize(Index jointI, 
+            const size_t * stepSize, size_t vec_size, Index * indices) ;
 
     /** \brief Calculates the step size array for nrElems. (so is of
      * the same size as nrElems).
@@ -45,8 +45,9 @@ MADPComponentDiscreteActions::MADPComponentDiscreteActions()
 {
     _m_initialized = false;
     _m_cachedAllJointActions = false;
+    _m_lazyJointActions = false;
     _m_actionStepSize = 0;
-    _m_jointActionIndices=0;
+    _m_jointActionMap=new map<Index, JointActionDiscrete*>;
     _m_jointIndicesValid=true;
 }
 
@@ -71,15 +72,12 @@ MADPComponentDiscreteActions::~MADPComponentDiscreteActions()
         it2++;
     }
     _m_jointActionVec.clear();
-    if(_m_jointActionIndices)
+    while(!_m_jointActionMap->empty())
     {
-        while(!_m_jointActionIndices->empty())
-        {
-            delete (*_m_jointActionIndices->begin()).second;
-            _m_jointActionIndices->erase( _m_jointActionIndices->begin() );
-        }
-        delete _m_jointActionIndices;
+        delete (*_m_jointActionMap->begin()).second;
+        _m_jointActionMap->erase( _m_jointActionMap->begin() );
     }
+    delete _m_jointActionMap;
 //     if(_m_jointActionIndices)
 //     {
 //         vector<vector<Index>*>::iterator it3 = _m_jointActionIndices->begin();
@@ -164,6 +162,13 @@ void MADPComponentDiscreteActions::AddAction(Index AI, string name)
  * action.*/
 size_t MADPComponentDiscreteActions::ConstructJointActions()
 {
+    if(_m_lazyJointActions)
+    {
+        size_t NRJA=1;
+        for(Index i=0;i!=_m_nrActions.size();++i)
+            NRJA*=_m_nrActions[i];
+        return NRJA;
+    }
     JointActionDiscrete* ja = new JointActionDiscrete();
     size_t NRJA = ConstructJointActionsRecursively(0, *ja, 0);
     _m_cachedAllJointActions=true;
@@ -295,8 +300,6 @@ bool MADPComponentDiscreteActions::SetInitialized(bool b)
                 prevNrJA=nrJA;
             }
             _m_nrJointActions=nrJA;
-            _m_jointActionIndices=
-                new map<Index, vector<Index> *>();
         }
         else
             _m_nrJointActions=_m_jointActionVec.size();
@@ -427,7 +430,19 @@ const JointActionDiscrete* MADPComponentDiscreteActions::GetJointActionDiscrete(
     }
     if(!_m_cachedAllJointActions)
     {
-        throw E("MADPComponentDiscreteActions::GetJointActionDiscrete: joint actions have not been created");
+        if(!_m_jointIndicesValid)
+            throw(E("MADPComponentDiscreteActions::GetJointActionDiscrete() joint indices are not available, overflow detected"));
+        if(i >= _m_nrJointActions)
+            throw E("WARNING MADPComponentDiscreteActions::GetJointActionDiscrete(Index i) index a out of bounds");
+
+        // we cached the ones already asked for
+        map<Index, JointActionDiscrete*>::const_iterator it=
+            _m_jointActionMap->find(i);
+        if(it!=_m_jointActionMap->end())
+            return(it->second);
+        JointActionDiscrete* ja=CreateJointActionDiscrete(i);
+        _m_jointActionMap->insert(make_pair(i,ja));
+        return(ja);
     }
     if(i < _m_jointActionVec.size() )
     {
@@ -442,23 +457,18 @@ const JointActionDiscrete* MADPComponentDiscreteActions::GetJointActionDiscrete(
 /*return a ref to the i-th joint action.*/
 const JointAction* MADPComponentDiscreteActions::GetJointAction(Index i) const
 {
-    if(!_m_initialized)
-    {
-        stringstream ss;
-            ss << "MADPComponentDiscreteActions::GetJointAction("<< 
-            i<<") - Error: not initialized. "<<endl;
-            throw E(ss);
-    }
-    if(!_m_cachedAllJointActions)
-    {
-        throw E("MADPComponentDiscreteActions::GetJointActionDiscrete: joint actions have not been created");
-    }
-    if(i < _m_jointActionVec.size() )
-        return( (const JointAction*) _m_jointActionVec[i] );
-    //else        
-    stringstream ss;
-    ss << "WARNING MADPComponentDiscreteActions::GetJointAction(Index i) index a out of bounds"<<endl;
-    throw E(ss);
+    return( (const JointAction*) GetJointActionDiscrete(i) );
+}
+
+JointActionDiscrete*
+MADPComponentDiscreteActions::CreateJointActionDiscrete(Index jaI) const
+{
+    Index * aIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+    JointToIndividualActionIndices(jaI, aIs);
+    JointActionDiscrete* ja = new JointActionDiscrete(jaI);
+    for(Index agI=0; agI < _m_nr_agents; agI++)
+        ja->AddIndividualAction(&_m_actionVecs[agI][aIs[agI]], agI);
+    return(ja);
 }
 
 Index MADPComponentDiscreteActions::IndividualToJointActionIndices(
@@ -536,6 +546,17 @@ string MADPComponentDiscreteActions::SoftPrintJointActionSet() const
             ") - Error: not initialized. "<<endl;
         throw E(ss);
     }   
+    if(!_m_cachedAllJointActions)
+    {
+        // don't cache all joint actions just for printing them
+        for(Index jaI=0; jaI < GetNrJointActions(); jaI++)
+        {
+            JointActionDiscrete* ja=CreateJointActionDiscrete(jaI);
+            ss << ja->SoftPrint()<<endl;
+            delete ja;
+        }
+        return(ss.str());
+    }
     vector<JointActionDiscrete*>::const_iterator ja_it = 
     _m_jointActionVec.begin();
     vector<JointActionDiscrete*>::const_iterator ja_last = 
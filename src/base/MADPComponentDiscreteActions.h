@@ -59,6 +59,8 @@ class MADPComponentDiscreteActions
     
         bool _m_initialized;    
         bool _m_cachedAllJointActions;
+        /// Whether ConstructJointActions() should only count them.
+        bool _m_lazyJointActions;
         bool _m_jointIndicesValid;
         size_t _m_nrJointActions;
 
@@ -73,14 +75,16 @@ class MADPComponentDiscreteActions
         std::vector<JointActionDiscrete*> _m_jointActionVec;
     
         /// When not all joint actions have been created, here we cache
-        /// the individual indices created by
-        /// JointToIndividualActionIndices()
-        std::map<Index, std::vector<Index> *> *_m_jointActionIndices;
+        /// the ones created by GetJointActionDiscrete()
+        std::map<Index, JointActionDiscrete*> *_m_jointActionMap;
 
         /// Recursively creates the joint actions.
         size_t ConstructJointActionsRecursively( Index curAgentI, 
             JointActionDiscrete& ja, Index jaI);
 
+        /// Creates joint action jaI from the individual actions.
+        JointActionDiscrete* CreateJointActionDiscrete(Index jaI) const;
+
         std::string SoftPrintActionSets() const;
         std::string SoftPrintJointActionSet() const;
 
@@ -109,9 +113,23 @@ class MADPComponentDiscreteActions
         /// Add a new action with name "name" to the actions of agent AI.
         void AddAction(Index AI, std::string name);
 
-        /// Recursively constructs all the joint actions.
+        /** \brief Recursively constructs all the joint actions.
+         *
+         * In lazy mode (see SetLazyJointActions()) only the number of
+         * joint actions is computed.*/
         size_t ConstructJointActions();
 
+        /** \brief Sets whether the joint actions should be created
+         * lazily.
+         *
+         * In lazy mode no JointActionDiscrete objects are created
+         * up front: joint <-> individual conversions use the step
+         * sizes, and GetJointActionDiscrete() creates the (few) joint
+         * actions that are asked for, typically for printing. Has
+         * effect only when called before ConstructJointActions().*/
+        void SetLazyJointActions(bool lazy)
+            { _m_lazyJointActions=lazy; }
+
         //get (data) functions:    
 
         /// Return the number of actions vector.
@@ -133,7 +151,7 @@ class MADPComponentDiscreteActions
 
         /// Returns the name of a particular joint action a.
         std::string GetJointActionName(Index a) const {
-            return(_m_jointActionVec.at(a)->SoftPrint()); } 
+            return(GetJointActionDiscrete(a)->SoftPrint()); } 
 
         /// Return a ref to the a-th action of agent agentI.
         const Action* GetAction(Index agentI, Index a) const;
@@ -160,7 +178,7 @@ class MADPComponentDiscreteActions
 
         /** \brief Returns a vector of indices to indiv. action
          * indicies corr. to joint action index jaI.*/
-        const std::vector<Index>& JointToIndividualActionIndices(Index jaI)const
+        std::vector<Index> JointToIndividualActionIndices(Index jaI) const
         {
             if(!_m_jointIndicesValid)
             {
@@ -169,18 +187,16 @@ class MADPComponentDiscreteActions
             if(_m_cachedAllJointActions)
                 return GetJointActionDiscrete(jaI)->
                     GetIndividualActionDiscretesIndices();
-            else if(_m_jointActionIndices->find(jaI)!=
-                    _m_jointActionIndices->end())
-                return(*_m_jointActionIndices->find(jaI)->second);
-            else // create new 
-            {
-                std::vector<Index> *indices=new std::vector<Index>();
-                *indices=IndexTools::JointToIndividualIndices(jaI,
-                                                              GetNrActions());
-                _m_jointActionIndices->insert(make_pair(jaI,indices));
-                return(*indices);
-            }
+            else
+                return IndexTools::JointToIndividualIndicesStepSize(
+                    jaI, _m_actionStepSize, _m_nr_agents);
         }
+
+        /** \brief Writes the indiv. action indices corr. to joint
+         * action index jaI to AI_ar (of size GetNrAgents()).*/
+        void JointToIndividualActionIndices(Index jaI, Index* AI_ar) const
+            {IndexTools::JointToIndividualIndicesArrayStepSize(
+                    jaI, _m_actionStepSize, _m_nr_agents, AI_ar);}
         
         std::string SoftPrint() const;
         void Print() const
@@ -40,7 +40,8 @@ MADPComponentDiscreteObservations::MADPComponentDiscreteObservations()
     _m_initialized = false;
     _m_observationStepSize = 0;
     _m_cachedAllJointObservations=false;
-    _m_jointObservationIndices=0;
+    _m_lazyJointObservations=false;
+    _m_jointObservationMap=new map<Index, JointObservationDiscrete*>;
     _m_jointIndicesValid=true;
 }
 
@@ -71,27 +72,12 @@ MADPComponentDiscreteObservations::~MADPComponentDiscreteObservations()
 
     _m_jointObservationVec.clear();
 
-    if(_m_jointObservationIndices)
+    while(!_m_jointObservationMap->empty())
     {
-        while(!_m_jointObservationIndices->empty())
-        {
-            delete (*_m_jointObservationIndices->begin()).second;
-            _m_jointObservationIndices->erase( _m_jointObservationIndices->begin() );
-        }
-        delete _m_jointObservationIndices;
+        delete (*_m_jointObservationMap->begin()).second;
+        _m_jointObservationMap->erase( _m_jointObservationMap->begin() );
     }
-#if 0
-    if(_m_jointObservationIndices)
-    {
-        vector<vector<Index>*>::iterator it3 = _m_jointObservationIndices->begin();
-        vector<vector<Index>*>::iterator last3 = _m_jointObservationIndices->end();
-        while(it3 != last3)
-        {
-            delete *it3; //removes the joint observation pointed to...
-            it3++;
-        }
-    }
-#endif
+    delete _m_jointObservationMap;
     delete[] _m_observationStepSize;
 }
 
@@ -103,6 +89,13 @@ MADPComponentDiscreteObservations::~MADPComponentDiscreteObservations()
 size_t MADPComponentDiscreteObservations::ConstructJointObservations()
 {
 if(DEBUG_CJO)    cerr << "ConstructJointObservations() - called";
+    if(_m_lazyJointObservations)
+    {
+        size_t NRJO=1;
+        for(Index i=0;i!=_m_nrObservations.size();++i)
+            NRJO*=_m_nrObservations[i];
+        return NRJO;
+    }
     JointObservationDiscrete* jo = new JointObservationDiscrete();
     size_t NRJO = ConstructJointObservationsRecursively(0, *jo, 0);
     _m_cachedAllJointObservations=true;
@@ -300,8 +293,6 @@ bool MADPComponentDiscreteObservations::SetInitialized(bool b)
                 prevNrJO=nrJO;
             }
             _m_nrJointObservations=nrJO;
-            _m_jointObservationIndices=
-                new map<Index, vector<Index> *>();
         }
         else
             _m_nrJointObservations=_m_jointObservationVec.size();
@@ -419,7 +410,23 @@ const JointObservationDiscrete* MADPComponentDiscreteObservations::
     }
     if(!_m_cachedAllJointObservations)
     {
-        throw E("MADPComponentDiscreteObservations::GetJointObservationDiscrete: joint observations have not been created");
+        if(!_m_jointIndicesValid)
+            throw(E("MADPComponentDiscreteObservations::GetJointObservationDiscrete() joint indices are not available, overflow detected"));
+        if(i >= _m_nrJointObservations)
+        {
+            stringstream ss;
+            ss << "WARNING MADPComponentDiscreteObservations::GetJointObservationDiscrete(Index i) index out of bounds (i="<< i <<")"<<endl;
+            throw E(ss);
+        }
+
+        // we cached the ones already asked for
+        map<Index, JointObservationDiscrete*>::const_iterator it=
+            _m_jointObservationMap->find(i);
+        if(it!=_m_jointObservationMap->end())
+            return(it->second);
+        JointObservationDiscrete* jo=CreateJointObservationDiscrete(i);
+        _m_jointObservationMap->insert(make_pair(i,jo));
+        return(jo);
     }
     if(i < _m_jointObservationVec.size() )
     {
@@ -434,24 +441,21 @@ const JointObservationDiscrete* MADPComponentDiscreteObservations::
 /*return a ref to the i-th joint observation.*/
 const JointObservation* MADPComponentDiscreteObservations::GetJointObservation(Index i) const
 {
-    if(!_m_initialized)
-    {
-        stringstream ss;
-        ss << "MADPComponentDiscreteObservations::GetJointObservation("<< 
-        i<<") - Error: not initialized. "<<endl;
-        throw E(ss);
-    }
-    if(!_m_cachedAllJointObservations)
-    {
-        throw E("MADPComponentDiscreteObservations::GetJointObservationDiscrete: joint observations have not been created");
-    }
-    if(i < _m_jointObservationVec.size() )
-        return( (const JointObservation*) _m_jointObservationVec[i] );
-    //else        
-    stringstream ss;
-    ss << "WARNING MADPComponentDiscreteObservations::GetJointObservation(Index i) index out of bounds (i="<< i <<")"<<endl;
-    throw E(ss);
+    return( (const JointObservation*) GetJointObservationDiscrete(i) );
+}
+
+JointObservationDiscrete* MADPComponentDiscreteObservations::
+    CreateJointObservationDiscrete(Index joI) const
+{
+    size_t nrAgents = _m_nrObservations.size();
+    Index * oIs = (Index *)_alloca(nrAgents * sizeof(Index));
+    JointToIndividualObservationIndices(joI, oIs);
+    JointObservationDiscrete* jo = new JointObservationDiscrete(joI);
+    for(Index agI=0; agI < nrAgents; agI++)
+        jo->AddIndividualObservation(&_m_observationVecs[agI][oIs[agI]], agI);
+    return(jo);
 }
+
 Index MADPComponentDiscreteObservations::IndividualToJointObservationIndices(
     const vector<Index>& indivObservationIndices)const
 {
@@ -519,6 +523,17 @@ string MADPComponentDiscreteObservations::SoftPrintJointObservationSet() const
        ") - Error: not initialized. "<<endl;
     throw E(ss);
     }
+    if(!_m_cachedAllJointObservations)
+    {
+        // don't cache all joint observations just for printing them
+        for(Index joI=0; joI < GetNrJointObservations(); joI++)
+        {
+            JointObservationDiscrete* jo=CreateJointObservationDiscrete(joI);
+            ss << jo->SoftPrint()<<endl;
+            delete jo;
+        }
+        return(ss.str());
+    }
     vector<JointObservationDiscrete*>::const_iterator jo_it = 
     _m_jointObservationVec.begin();
     vector<JointObservationDiscrete*>::const_iterator jo_last = 
@@ -56,6 +56,8 @@ class MADPComponentDiscreteObservations:
 
         bool _m_initialized;
         bool _m_cachedAllJointObservations;
+        /// Whether ConstructJointObservations() should only count them.
+        bool _m_lazyJointObservations;
         bool _m_jointIndicesValid;
         size_t _m_nrJointObservations;
     
@@ -66,15 +68,18 @@ class MADPComponentDiscreteObservations:
         /** To use this, ConstructJointObservations() should be called */
         std::vector<JointObservationDiscrete*> _m_jointObservationVec;
 
-        /// When not all joint observations have been created, here we cache
-        /// the individual indices created by
-        /// JointToIndividualObservationIndices()
-        std::map<Index, std::vector<Index> *> *_m_jointObservationIndices;
+        /// When not all joint observations have been created, here we
+        /// cache the ones created by GetJointObservationDiscrete()
+        std::map<Index, JointObservationDiscrete*> *_m_jointObservationMap;
 
         /// Recursively creates the joint observations.
         size_t ConstructJointObservationsRecursively( Index curAgentI, 
             JointObservationDiscrete& jo, Index joI);
 
+        /// Creates joint observation joI from the individual observations.
+        JointObservationDiscrete* CreateJointObservationDiscrete(Index joI)
+            const;
+
         std::string SoftPrintObservationSets() const;
         std::string SoftPrintJointObservationSet() const;
 
@@ -104,9 +109,19 @@ class MADPComponentDiscreteObservations:
         /// Add a new observation with name "name" to the observ. of agent AI.
         void AddObservation(Index AI, std::string name);
 
-        /// Recursively constructs all the joint observations.
+        /** \brief Recursively constructs all the joint observations.
+         *
+         * In lazy mode (see SetLazyJointObservations()) only the
+         * number of joint observations is computed.*/
         size_t ConstructJointObservations();
 
+        /** \brief Sets whether the joint observations should be
+         * created lazily.
+         *
+         * See MADPComponentDiscreteActions::SetLazyJointActions().*/
+        void SetLazyJointObservations(bool lazy)
+            { _m_lazyJointObservations=lazy; }
+
         //get (data) functions:
 
         /// Return the number of observations vector.    
@@ -128,7 +143,7 @@ class MADPComponentDiscreteObservations:
 
         /// Returns the name of a particular joint observation o. 
          std::string GetJointObservationName(Index o) const {
-            return(_m_jointObservationVec.at(o)->SoftPrint()); } 
+            return(GetJointObservationDiscrete(o)->SoftPrint()); } 
 
         /// Return a ref to the a-th observation of agent agentI.
         const ObservationDiscrete* GetObservationDiscrete(Index agentI, 
@@ -153,8 +168,7 @@ class MADPComponentDiscreteObservations:
 
         /** \brief Returns a vector of indices to indiv. observation
          * indicies corr. to joint observation index joI.*/
-        const std::vector<Index>& 
-            JointToIndividualObservationIndices(Index joI) const
+        std::vector<Index> JointToIndividualObservationIndices(Index joI) const
         {
             if(!_m_jointIndicesValid)
             {
@@ -163,18 +177,18 @@ class MADPComponentDiscreteObservations:
             if(_m_cachedAllJointObservations)
                 return GetJointObservationDiscrete(joI)->
                     GetIndividualObservationDiscretesIndices();
-            else if(_m_jointObservationIndices->find(joI)!=
-                    _m_jointObservationIndices->end())
-                return(*_m_jointObservationIndices->find(joI)->second);
-            else // create new 
-            {
-                std::vector<Index> *indices=new std::vector<Index>();
-                *indices=IndexTools::JointToIndividualIndices(joI,
-                                                              GetNrObservations());
-                _m_jointObservationIndices->insert(make_pair(joI,indices));
-                return(*indices);
-            }
+            else
+                return IndexTools::JointToIndividualIndicesStepSize(
+                    joI, _m_observationStepSize, _m_nrObservations.size());
         } 
+
+        /** \brief Writes the indiv. observation indices corr. to
+         * joint observation index joI to OI_ar (of size
+         * GetNrAgents()).*/
+        void JointToIndividualObservationIndices(Index joI, Index* OI_ar) const
+            {IndexTools::JointToIndividualIndicesArrayStepSize(
+                    joI, _m_observationStepSize, _m_nrObservations.size(),
+                    OI_ar);}
             
         std::string SoftPrint() const;
         void Print() const
@@ -30,6 +30,9 @@
 #include "ObservationModelMappingSparse.h"    
 #include "TransitionModelMapping.h"    
 #include "TransitionModelMappingSparse.h"    
+#include "TransitionModel2DBN.h"
+#include "ObservationModel2DBN.h"
+#include "TwoStageDynamicBayesianNetwork.h"
 #include <stdio.h>
 
 #include "TGet.h"
@@ -99,22 +102,26 @@ void MultiAgentDecisionProcessDiscrete::CreateNewTransitionModel()
 
 TGet* MultiAgentDecisionProcessDiscrete::GetTGet() const
 { 
-    if(_m_sparse)
-        return new TGet_TransitionModelMappingSparse(
-                ((TransitionModelMappingSparse*)_m_p_tModel)  ); 
-    else
-        return new TGet_TransitionModelMapping(
-                ((TransitionModelMapping*)_m_p_tModel)  );
+    TransitionModelMappingSparse *tms;
+    TransitionModelMapping *tm;
+    if((tms=dynamic_cast<TransitionModelMappingSparse *>(_m_p_tModel)))
+        return new TGet_TransitionModelMappingSparse(tms);
+    else if((tm=dynamic_cast<TransitionModelMapping *>(_m_p_tModel)))
+        return new TGet_TransitionModelMapping(tm);
+    else // e.g., a TransitionModel2DBN
+        return new TGet_TransitionModelDiscrete(_m_p_tModel);
 }
 
 OGet* MultiAgentDecisionProcessDiscrete::GetOGet() const
 { 
-    if(_m_sparse)
-        return new OGet_ObservationModelMappingSparse(
-                ((ObservationModelMappingSparse*)_m_p_oModel)  ); 
-    else
-        return new OGet_ObservationModelMapping(
-                ((ObservationModelMapping*)_m_p_oModel)  );
+    ObservationModelMappingSparse *oms;
+    ObservationModelMapping *om;
+    if((oms=dynamic_cast<ObservationModelMappingSparse *>(_m_p_oModel)))
+        return new OGet_ObservationModelMappingSparse(oms);
+    else if((om=dynamic_cast<ObservationModelMapping *>(_m_p_oModel)))
+        return new OGet_ObservationModelMapping(om);
+    else // e.g., an ObservationModel2DBN
+        return new OGet_ObservationModelDiscrete(_m_p_oModel);
 }
 
 void MultiAgentDecisionProcessDiscrete::CreateNewObservationModel()
@@ -209,8 +216,19 @@ bool MultiAgentDecisionProcessDiscrete::SanityCheck(void)
     double sum,p;
     bool sane=true;
 
+    // factored models are checked per CPT, which avoids enumerating all
+    // (s,a,s') and (a,s',o) tuples
+    const TransitionModel2DBN *t2dbn=
+        dynamic_cast<const TransitionModel2DBN *>(_m_p_tModel);
+    const ObservationModel2DBN *o2dbn=
+        dynamic_cast<const ObservationModel2DBN *>(_m_p_oModel);
+    if(t2dbn)
+        t2dbn->Get2DBN()->SanityCheck();
+    if(o2dbn && (!t2dbn || o2dbn->Get2DBN()!=t2dbn->Get2DBN()))
+        o2dbn->Get2DBN()->SanityCheck();
+
     // check transition model
-    for(Index a=0;a<nrJA;a++)
+    for(Index a=0;a<nrJA && !t2dbn;a++)
     {
         for(Index from=0;from<nrS;from++)
         {
@@ -258,7 +276,7 @@ bool MultiAgentDecisionProcessDiscrete::SanityCheck(void)
     }
 
     // check observation model
-    for(Index a=0;a<nrJA;a++)
+    for(Index a=0;a<nrJA && !o2dbn;a++)
     {
         for(Index to=0;to<nrS;to++)
         {
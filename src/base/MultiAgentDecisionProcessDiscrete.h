@@ -180,6 +180,17 @@ class MultiAgentDecisionProcessDiscrete :
         /// Are we using sparse transition and observation models?
         bool GetSparse() const { return(_m_sparse); }
 
+        /**\brief Indicate whether joint actions and observations
+         * should be created lazily.
+         *
+         * Default is to create all of them. Only has effect before
+         * the joint actions and observations are constructed. */
+        void SetLazyJointSpaces(bool lazy)
+        {
+            SetLazyJointActions(lazy);
+            SetLazyJointObservations(lazy);
+        }
+
         const TransitionModelDiscrete* GetTransitionModelDiscretePtr() const
         { return(_m_p_tModel); }
 
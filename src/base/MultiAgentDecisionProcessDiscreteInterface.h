@@ -111,8 +111,13 @@ class MultiAgentDecisionProcessDiscreteInterface :
                 indivActionIndices) const = 0;
         /**\brief Returns a vector of indices to indiv. action indicies corr.
          * to joint action index jaI.*/
-        virtual const std::vector<Index>& JointToIndividualActionIndices(
+        virtual std::vector<Index> JointToIndividualActionIndices(
                 Index jaI) const = 0;
+        /**\brief Writes the indiv. action indices corr. to joint
+         * action index jaI to AI_ar, which should have room for
+         * GetNrAgents() entries.*/
+        virtual void JointToIndividualActionIndices(Index jaI, Index* AI_ar)
+            const = 0;
         
 
         ///Return the number of observations vector.    
@@ -135,8 +140,14 @@ class MultiAgentDecisionProcessDiscreteInterface :
                 indivObservationIndices) const = 0;
         /**\brief Returns a vector of indices to indiv. observation indicies
          * corr. to joint observation index jaI.*/
-        virtual const std::vector<Index>& 
+        virtual std::vector<Index> 
             JointToIndividualObservationIndices(Index joI) const = 0;
+        /**\brief Writes the indiv. observation indices corr. to joint
+         * observation index joI to OI_ar, which should have room for
+         * GetNrAgents() entries.*/
+        virtual void JointToIndividualObservationIndices(Index joI,
+                                                         Index* OI_ar)
+            const = 0;
 
         ///Return the probability of successor state sucSI: P(sucSI|sI,jaI).
         virtual double GetTransitionProbability(Index sI, Index jaI, Index 
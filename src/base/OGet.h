@@ -84,6 +84,24 @@ public:
 
 };
 
+/** \brief OGet_ObservationModelDiscrete can be used for access to any
+ * ObservationModelDiscrete, such as an ObservationModel2DBN, via its
+ * (virtual) Get(). */
+class OGet_ObservationModelDiscrete : public OGet
+{
+
+private:
+    const ObservationModelDiscrete* _m_O;
+public:
+    OGet_ObservationModelDiscrete( const ObservationModelDiscrete* om)
+    {
+        _m_O = om;
+    };
+
+    virtual double Get(Index jaI, Index sucSI, Index joI) const
+        {  { return(_m_O->Get(jaI,sucSI,joI)); } }
+};
+
 #endif /* !_OGET_H_ */
 
 // Local Variables: ***
@@ -0,0 +1,44 @@
+/**\file ObservationModel2DBN.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "ObservationModel2DBN.h"
+
+using namespace std;
+
+ObservationModel2DBN::ObservationModel2DBN(
+    const boost::shared_ptr<const TwoStageDynamicBayesianNetwork>& dbn) :
+    ObservationModelDiscrete(dbn->GetNrStates(), dbn->GetNrJointActions(),
+                             dbn->GetNrJointObservations()),
+    _m_2dbn(dbn)
+{
+}
+
+void ObservationModel2DBN::Set(Index ja_i, Index suc_s_i, Index jo_i,
+                               double prob)
+{
+    throw(E("ObservationModel2DBN::Set() not supported, set the CPTs of the TwoStageDynamicBayesianNetwork instead"));
+}
@@ -0,0 +1,81 @@
+/**\file ObservationModel2DBN.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _OBSERVATIONMODEL2DBN_H_
+#define _OBSERVATIONMODEL2DBN_H_ 1
+
+/* the include directives */
+#include <boost/shared_ptr.hpp>
+#include "Globals.h"
+#include "ObservationModelDiscrete.h"
+#include "TwoStageDynamicBayesianNetwork.h"
+
+/// ObservationModel2DBN implements an ObservationModelDiscrete.
+/** It uses a TwoStageDynamicBayesianNetwork: P(jo|ja,s') is computed as
+ * the product of the observation CPTs of the agents when requested,
+ * such that the (flat) observation model is never stored. */
+class ObservationModel2DBN : public ObservationModelDiscrete
+{
+private:
+    boost::shared_ptr<const TwoStageDynamicBayesianNetwork> _m_2dbn;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructor.
+    ObservationModel2DBN(
+        const boost::shared_ptr<const TwoStageDynamicBayesianNetwork>& dbn);
+
+    /// Returns P(jo|ja,s')
+    double Get(Index ja_i, Index suc_s_i, Index jo_i) const
+        { return(_m_2dbn->GetObservationProbability(ja_i, suc_s_i, jo_i)); }
+
+    /// Not supported: the probabilities are defined by the CPTs of the 2DBN.
+    void Set(Index ja_i, Index suc_s_i, Index jo_i, double prob);
+
+    /// Sample a joint observation, one agent at a time.
+    Index SampleJointObservation(Index jaI, Index sucI)
+        { return(_m_2dbn->SampleJointObservation(jaI, sucI)); }
+
+    /// Get the 2DBN that defines this observation model.
+    const TwoStageDynamicBayesianNetwork* Get2DBN() const
+        { return(_m_2dbn.get()); }
+
+    /// Returns a pointer to a copy of this class.
+    virtual ObservationModel2DBN* Clone() const
+        { return new ObservationModel2DBN(*this); }
+
+};
+
+#endif /* !_OBSERVATIONMODEL2DBN_H_ */
+
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
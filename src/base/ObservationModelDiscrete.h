@@ -68,7 +68,7 @@ public:
     virtual void Set(Index ja_i, Index suc_s_i, Index jo_i, double prob) = 0;
         
     /// Sample a joint observation.
-    Index SampleJointObservation(Index jaI, Index sucI);
+    virtual Index SampleJointObservation(Index jaI, Index sucI);
 
     /// Returns a pointer to a copy of this class.
     virtual ObservationModelDiscrete* Clone() const = 0;
@@ -42,7 +42,7 @@ private:
     std::string _m_s_str;
     std::string _m_ja_str;
     
-    typedef boost::numeric::ublas::matrix<double> Matrix;
+    typedef boost::numeric::ublas::matrix<Scalar> Matrix;
 
     Matrix _m_R;
 
@@ -49,6 +49,25 @@ double RewardModelTOISparse::Get(const std::vector<Index> &sIs,
         return(0);
 }
 
+double RewardModelTOISparse::GetExpected(
+    const vector<vector<double> > &marginals,
+    const vector<Index> &aIs) const
+{
+    double r=0;
+    map<pair<vector<Index>,vector<Index> >,double>::const_iterator it;
+    for(it=_m_R.begin();it!=_m_R.end();++it)
+    {
+        if(it->first.second!=aIs)
+            continue;
+        const vector<Index> &sIs=it->first.first;
+        double p=it->second;
+        for(Index i=0;i!=sIs.size() && p!=0;++i)
+            p*=marginals[i][sIs[i]];
+        r+=p;
+    }
+    return(r);
+}
+
 void RewardModelTOISparse::Set(const std::vector<Index> &sIs,
                                const std::vector<Index> &aIs,
                                double reward)
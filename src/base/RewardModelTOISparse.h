@@ -69,6 +69,15 @@ public:
     /// Returns R(s,ja)
     double Get(const std::vector<Index> &sIs,
                const std::vector<Index> &aIs) const;
+
+    /**\brief Returns the expected reward of the individual actions
+     * \a aIs, when the individual states are distributed
+     * independently according to \a marginals.
+     *
+     * Only the stored (non-zero) rewards for \a aIs are visited, so
+     * the joint state space is never enumerated. */
+    double GetExpected(const std::vector<std::vector<double> > &marginals,
+                       const std::vector<Index> &aIs) const;
 #if 0
     double Get(Index s_i, Index ja_i) const
         {
@@ -84,6 +84,24 @@ public:
 
 };
 
+/** \brief TGet_TransitionModelDiscrete can be used for access to any
+ * TransitionModelDiscrete, such as a TransitionModel2DBN, via its
+ * (virtual) Get(). */
+class TGet_TransitionModelDiscrete : public TGet
+{
+
+private:
+    const TransitionModelDiscrete* _m_T;
+public:
+    TGet_TransitionModelDiscrete( const TransitionModelDiscrete* tm)
+    {
+        _m_T = tm;
+    };
+
+    virtual double Get(Index sI, Index jaI, Index sucSI) const
+    {  { return(_m_T->Get(sI,jaI,sucSI)); } }
+};
+
 #endif /* !_TGET_H_ */
 
 // Local Variables: ***
@@ -200,6 +200,53 @@ GetTwoAgentReward(Index i, Index j,
     return(reward);
 }
 
+double TOICompactRewardDecPOMDPDiscrete::GetExpectedReward(
+    const vector<vector<double> > &marginals,
+    const vector<Index> &aIs) const
+{
+    double reward=0;
+
+    for(unsigned int i=0;i!=GetNrAgents();++i)
+        reward+=GetExpectedIndividualReward(marginals[i],aIs[i],i);
+
+    switch(GetNrAgents())
+    {
+    case 2:
+        reward+=_m_p_rModel->GetExpected(marginals,aIs);
+        break;
+    default:
+    {
+        // the shared reward is defined for each ordered pair of agents,
+        // see GetReward()
+        vector<vector<double> > pairMarginals(2);
+        vector<Index> pairAIs(2,0);
+        for(Index i=0;i!=GetNrAgents();++i)
+            for(Index j=0;j!=GetNrAgents();++j)
+            {
+                if(i==j)
+                    continue;
+                pairMarginals[0]=marginals[i]; pairAIs[0]=aIs[i];
+                pairMarginals[1]=marginals[j]; pairAIs[1]=aIs[j];
+                reward+=_m_p_rModel->GetExpected(pairMarginals,pairAIs);
+            }
+        break;
+    }
+    }
+
+    return(reward);
+}
+
+double TOICompactRewardDecPOMDPDiscrete::
+GetExpectedIndividualReward(const vector<double> &b, Index indAI,
+                            Index agentID) const
+{
+    double reward=0;
+    for(Index sI=0;sI!=b.size();++sI)
+        if(b[sI]!=0)
+            reward+=b[sI]*_m_p_rModels[agentID]->Get(sI,indAI);
+    return(reward);
+}
+
 void TOICompactRewardDecPOMDPDiscrete::
 SetIndividualRewardModel(RewardModel* rewardModel,
                          Index agentID)
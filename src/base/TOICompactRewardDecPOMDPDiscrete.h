@@ -85,6 +85,11 @@ public:
                      const std::vector<Index> &aIs) const;
 
     double GetIndividualReward(Index indSI, Index indAI, Index agentID) const;
+    double GetExpectedReward(const std::vector<std::vector<double> > &marginals,
+                             const std::vector<Index> &aIs) const;
+    /// Returns the expected individual reward of agentID under \a b.
+    double GetExpectedIndividualReward(const std::vector<double> &b,
+                                       Index indAI, Index agentID) const;
 
     /// Returns a pointer to a copy of this class.
     virtual TOICompactRewardDecPOMDPDiscrete* Clone() const
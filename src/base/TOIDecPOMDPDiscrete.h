@@ -144,6 +144,18 @@ public:
                              const std::vector<Index> &aIs) const
         { return(_m_p_rModel->Get(sIs, aIs));
         }
+
+    /**\brief Returns the expected reward of the individual actions
+     * \a aIs for a belief that is the product of the per-agent
+     * \a marginals over the individual states.
+     *
+     * This avoids enumerating the joint state space, see
+     * JointBeliefTOI. */
+    virtual double
+    GetExpectedReward(const std::vector<std::vector<double> > &marginals,
+                      const std::vector<Index> &aIs) const
+        { return(_m_p_rModel->GetExpected(marginals, aIs));
+        }
     
     std::vector<double> GetRewards(Index sI, Index jaI) const;
     
@@ -128,6 +128,31 @@ TOIFactoredRewardDecPOMDPDiscrete::GetReward(const std::vector<Index> &sIs,
     return(reward);
 }
 
+double TOIFactoredRewardDecPOMDPDiscrete::GetExpectedReward(
+    const vector<vector<double> > &marginals,
+    const vector<Index> &aIs) const
+{
+    double reward=0;
+
+    for(unsigned int i=0;i!=GetNrAgents();++i)
+        reward+=GetExpectedIndividualReward(marginals[i],aIs[i],i);
+
+    reward+=_m_p_rModel->GetExpected(marginals,aIs);
+
+    return(reward);
+}
+
+double TOIFactoredRewardDecPOMDPDiscrete::
+GetExpectedIndividualReward(const vector<double> &b, Index indAI,
+                            Index agentID) const
+{
+    double reward=0;
+    for(Index sI=0;sI!=b.size();++sI)
+        if(b[sI]!=0)
+            reward+=b[sI]*_m_p_rModels[agentID]->Get(sI,indAI);
+    return(reward);
+}
+
 void TOIFactoredRewardDecPOMDPDiscrete::
 SetIndividualRewardModel(RewardModel* rewardModel,
                          Index agentID)
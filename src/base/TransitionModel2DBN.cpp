@@ -0,0 +1,42 @@
+/**\file TransitionModel2DBN.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "TransitionModel2DBN.h"
+
+using namespace std;
+
+TransitionModel2DBN::TransitionModel2DBN(
+    const boost::shared_ptr<const TwoStageDynamicBayesianNetwork>& dbn) :
+    TransitionModelDiscrete(dbn->GetNrStates(), dbn->GetNrJointActions()),
+    _m_2dbn(dbn)
+{
+}
+
+void TransitionModel2DBN::Set(Index sI, Index jaI, Index sucSI, double prob)
+{
+    throw(E("TransitionModel2DBN::Set() not supported, set the CPTs of the TwoStageDynamicBayesianNetwork instead"));
+}
@@ -0,0 +1,82 @@
+/**\file TransitionModel2DBN.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _TRANSITIONMODEL2DBN_H_
+#define _TRANSITIONMODEL2DBN_H_ 1
+
+/* the include directives */
+#include <boost/shared_ptr.hpp>
+#include "Globals.h"
+#include "TransitionModelDiscrete.h"
+#include "TwoStageDynamicBayesianNetwork.h"
+
+/// TransitionModel2DBN implements a TransitionModelDiscrete.
+/** It uses a TwoStageDynamicBayesianNetwork: P(s'|s,ja) is computed as
+ * the product of the CPTs of the state factors when requested, such
+ * that the (flat) transition model is never stored. The 2DBN is shared
+ * with the ObservationModel2DBN of the same problem. */
+class TransitionModel2DBN : public TransitionModelDiscrete
+{
+private:
+    boost::shared_ptr<const TwoStageDynamicBayesianNetwork> _m_2dbn;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructor.
+    TransitionModel2DBN(
+        const boost::shared_ptr<const TwoStageDynamicBayesianNetwork>& dbn);
+
+    /// Returns P(s'|s,ja).
+    double Get(Index sI, Index jaI, Index sucSI) const
+        { return(_m_2dbn->GetTransitionProbability(sI, jaI, sucSI)); }
+
+    /// Not supported: the probabilities are defined by the CPTs of the 2DBN.
+    void Set(Index sI, Index jaI, Index sucSI, double prob);
+
+    /// Sample a successor state, one state factor at a time.
+    Index SampleSuccessorState(Index sI, Index jaI)
+        { return(_m_2dbn->SampleSuccessorState(sI, jaI)); }
+
+    /// Get the 2DBN that defines this transition model.
+    const TwoStageDynamicBayesianNetwork* Get2DBN() const
+        { return(_m_2dbn.get()); }
+
+    /// Returns a pointer to a copy of this class.
+    virtual TransitionModel2DBN* Clone() const
+        { return new TransitionModel2DBN(*this); }
+
+};
+
+#endif /* !_TRANSITIONMODEL2DBN_H_ */
+
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
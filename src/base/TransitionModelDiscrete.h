@@ -65,7 +65,7 @@ public:
     virtual void Set(Index sI, Index jaI, Index sucSI, double prob) = 0;
 
     /// Sample a successor state.
-    Index SampleSuccessorState(Index sI, Index jaI);
+    virtual Index SampleSuccessorState(Index sI, Index jaI);
        
     /// Returns a pointer to a copy of this class.
     virtual TransitionModelDiscrete* Clone() const = 0;
@@ -49,14 +49,17 @@ TransitionObservationIndependentMADPDiscrete(
     _m_initialized = false;
     _m_sparse = false;
     _m_noJointModels = false;
+    _m_lazyJointSpaces = false;
+    _m_actionStepSize = 0;
+    _m_observationStepSize = 0;
+    _m_stateStepSize = 0;
     _m_nrJointActions=0;
     _m_nrJointStates=0;
     _m_nrJointObservations=0;
     _m_p_tModel = 0;
     _m_p_oModel = 0;
     // these are pointers to get around the const-ness of their Get functions
-    _m_jointStatesMap=new map<vector<Index>, State*>;
-    _m_indivStateIndicesMap = new map< Index, vector<Index> >;
+    _m_jointStatesMap=new map<Index, State*>;
     _m_jointActionMap=new map<Index, JointActionDiscrete*>;
     _m_jointObsMap=new map<Index, JointObservationDiscrete*>;
     _m_initialStateDistribution=0;
@@ -242,9 +245,11 @@ void TransitionObservationIndependentMADPDiscrete::CreateJointActions()
     for(Index agI = 0; agI < GetNrAgents(); agI++)
         _m_nrIndivActions.push_back(GetIndividualMADPD(agI)->GetNrActions(0));
 
-    for(Index ja=0;ja!=_m_nrJointActions;++ja)
-        _m_jointToIndActionCache.push_back(
-            JointToIndividualActionIndicesNoCache(ja));
+    _m_jointToIndActionCache.clear();
+    if(!_m_noJointModels)
+        for(Index ja=0;ja!=_m_nrJointActions;++ja)
+            _m_jointToIndActionCache.push_back(
+                JointToIndividualActionIndicesNoCache(ja));
 }
 
 size_t TransitionObservationIndependentMADPDiscrete::
@@ -362,20 +367,13 @@ TransitionObservationIndependentMADPDiscrete::GetState(Index i) const
 {
     if(!_m_noJointModels) // we cached all joint states
         return(_m_jointStates.at(i));
-    else
-        return(GetState(JointToIndividualStateIndices(i)));
-}
-
-const State* TransitionObservationIndependentMADPDiscrete::GetState(
-    const std::vector<Index> &sIs) const
-{
     // we cached the ones already asked for
-    if(_m_jointStatesMap->find(sIs)!=_m_jointStatesMap->end())
-        return(_m_jointStatesMap->find(sIs)->second);
+    else if(_m_jointStatesMap->find(i)!=_m_jointStatesMap->end())
+        return(_m_jointStatesMap->find(i)->second);
     else // create new joint state and add it to cache
     {
-        State *state=new State; // not a StateDiscrete, since the
-                                // index might overflow
+        vector<Index> sIs=JointToIndividualStateIndices(i);
+        State *state=new StateDiscrete(i);
         string name="";
         for(Index agI = 0; agI < GetNrAgents(); agI++)
         {
@@ -385,12 +383,18 @@ const State* TransitionObservationIndependentMADPDiscrete::GetState(
         }
         state->SetName(name);
         state->SetDescription("");
-        _m_jointStatesMap->insert(make_pair(sIs,state));
+        _m_jointStatesMap->insert(make_pair(i,state));
         return(state);
     }
 
 }
 
+const State* TransitionObservationIndependentMADPDiscrete::GetState(
+    const std::vector<Index> &sIs) const
+{
+    return(GetState(IndividualToJointStateIndices(sIs)));
+}
+
 const JointActionDiscrete* 
 TransitionObservationIndependentMADPDiscrete::GetJointActionDiscrete(Index i) const
 {
@@ -402,8 +406,7 @@ TransitionObservationIndependentMADPDiscrete::GetJointActionDiscrete(Index i) co
     else // create new joint action and add it to cache
     {
         JointActionDiscrete *action=new JointActionDiscrete(i);
-        vector<Index> ind_sI=
-            IndexTools::JointToIndividualIndices(i,_m_nrIndivActions);
+        vector<Index> ind_sI=JointToIndividualActionIndices(i);
         for(Index agI = 0; agI < GetNrAgents(); agI++)
             action->AddIndividualAction(
                 GetIndividualMADPD(agI)->GetActionDiscrete(0,ind_sI[agI]),
@@ -425,8 +428,7 @@ TransitionObservationIndependentMADPDiscrete::GetJointObservation(Index i) const
     else // create new joint obs and add it to cache
     {
         JointObservationDiscrete *observation=new JointObservationDiscrete(i);
-        vector<Index> ind_sI=
-            IndexTools::JointToIndividualIndices(i,_m_nrIndivObs);
+        vector<Index> ind_sI=JointToIndividualObservationIndices(i);
         for(Index agI = 0; agI < GetNrAgents(); agI++)
             observation->AddIndividualObservation(
                 GetIndividualMADPD(agI)->GetObservationDiscrete(0,ind_sI[agI]),
@@ -437,22 +439,37 @@ TransitionObservationIndependentMADPDiscrete::GetJointObservation(Index i) const
     }
 }
 
-const std::vector<Index>&
+vector<Index>
 TransitionObservationIndependentMADPDiscrete::
 JointToIndividualStateIndices(Index jointSI) const
 {
     if(!_m_noJointModels)
         return _m_indivStateIndices[jointSI];
-    else if (_m_indivStateIndicesMap->find(jointSI)!=
-             _m_indivStateIndicesMap->end())
-        return(_m_indivStateIndicesMap->find(jointSI)->second);
     else
-    {
-        vector<Index> ind_sI=
-            IndexTools::JointToIndividualIndices(jointSI,_m_nrIndivStates);
-        _m_indivStateIndicesMap->insert(make_pair(jointSI,ind_sI));
-        return(_m_indivStateIndicesMap->find(jointSI)->second);
-    }
+        return(IndexTools::JointToIndividualIndicesStepSize(
+                   jointSI, _m_stateStepSize, _m_nr_agents));
+}
+
+vector<Index>
+TransitionObservationIndependentMADPDiscrete::
+JointToIndividualActionIndices(Index jaI) const
+{
+    if(!_m_noJointModels)
+        return(_m_jointToIndActionCache.at(jaI));
+    else
+        return(IndexTools::JointToIndividualIndicesStepSize(
+                   jaI, _m_actionStepSize, _m_nr_agents));
+}
+
+vector<Index>
+TransitionObservationIndependentMADPDiscrete::
+JointToIndividualObservationIndices(Index joI) const
+{
+    if(!_m_noJointModels)
+        return(_m_jointToIndObsCache.at(joI));
+    else
+        return(IndexTools::JointToIndividualIndicesStepSize(
+                   joI, _m_observationStepSize, _m_nr_agents));
 }
 
 void TransitionObservationIndependentMADPDiscrete::CreateJointObservations()
@@ -489,6 +506,7 @@ void TransitionObservationIndependentMADPDiscrete::CreateJointObservations()
         if(_m_nrJointObservations!=_m_jointObs.size())
             throw(E("TransitionObservationIndependentMADPDiscrete::CreateJointObservations() sizes do not match"));
 
+    _m_jointToIndObsCache.clear();
     for(Index jo=0;jo!=_m_nrJointObservations;++jo)
         _m_jointToIndObsCache.push_back(
             JointToIndividualObservationIndicesNoCache(jo));
@@ -600,7 +618,11 @@ bool TransitionObservationIndependentMADPDiscrete::SetInitialized(bool b)
     if(b == false)
     {
         if(_m_initialized == true)
+        {
             delete [] _m_actionStepSize;
+            delete [] _m_observationStepSize;
+            delete [] _m_stateStepSize;
+        }
         _m_initialized = false;
         return(true);
     }
@@ -608,6 +630,8 @@ bool TransitionObservationIndependentMADPDiscrete::SetInitialized(bool b)
     {
         //first free mem before re-initialize:
         delete [] _m_actionStepSize;
+        delete [] _m_observationStepSize;
+        delete [] _m_stateStepSize;
     }
 
     if(DEBUG_TOIMADPD)
@@ -631,7 +655,7 @@ bool TransitionObservationIndependentMADPDiscrete::SetInitialized(bool b)
         }
 
         // most likely we will not have the memory space to store all this...
-        if(GetNrAgents()>2)
+        if(GetNrAgents()>2 || _m_lazyJointSpaces)
             _m_noJointModels=true;
         
         //now perform the necessary actions for this class...
@@ -643,6 +667,8 @@ bool TransitionObservationIndependentMADPDiscrete::SetInitialized(bool b)
 
         _m_nr_agents=GetNrAgents();
         _m_actionStepSize=IndexTools::CalculateStepSize(_m_nrIndivActions);
+        _m_observationStepSize=IndexTools::CalculateStepSize(_m_nrIndivObs);
+        _m_stateStepSize=IndexTools::CalculateStepSize(_m_nrIndivStates);
         
         _m_initialized = b;
     }
@@ -871,10 +897,13 @@ GetTransitionProbability(Index sI,
     double p=1;
     if(_m_noJointModels)
     {
-        vector<Index> sIs=JointToIndividualStateIndices(sI),
-            sucSIs=JointToIndividualStateIndices(sucSI);
-        vector<Index> aIs=JointToIndividualActionIndices(jaI);
-        for(Index agI = 0; agI < GetNrAgents(); agI++)
+        Index * sIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        Index * sucSIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        Index * aIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        JointToIndividualStateIndices(sI, sIs);
+        JointToIndividualStateIndices(sucSI, sucSIs);
+        JointToIndividualActionIndices(jaI, aIs);
+        for(Index agI = 0; agI < _m_nr_agents; agI++)
         {
             p*=GetIndividualMADPD(agI)->GetTransitionProbability(
                 sIs[agI],
@@ -925,10 +954,13 @@ GetObservationProbability(Index jaI,
     double p=1;
     if(_m_noJointModels)
     {
-        vector<Index> sucSIs=JointToIndividualStateIndices(sucSI);
-        vector<Index> aIs=JointToIndividualActionIndices(jaI);
-        vector<Index> oIs=JointToIndividualObservationIndices(joI);
-        for(Index agI = 0; agI < GetNrAgents(); agI++)
+        Index * sucSIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        Index * aIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        Index * oIs = (Index *)_alloca(_m_nr_agents * sizeof(Index));
+        JointToIndividualStateIndices(sucSI, sucSIs);
+        JointToIndividualActionIndices(jaI, aIs);
+        JointToIndividualObservationIndices(joI, oIs);
+        for(Index agI = 0; agI < _m_nr_agents; agI++)
         {
             p*=GetIndividualMADPD(agI)->GetObservationProbability(
                 aIs[agI],
@@ -38,6 +38,7 @@
 #include "MultiAgentDecisionProcessDiscrete.h"
 #include <map>
 #include "StateDistributionVector.h"
+#include "IndexTools.h"
 
 /** 
  * \brief TransitionObservationIndependentMADPDiscrete is an base class that 
@@ -64,6 +65,8 @@ private:
 
     /// Boolean indicating whether joint models should be generated.
     bool _m_noJointModels;
+    /// Boolean indicating whether joint spaces should be created lazily.
+    bool _m_lazyJointSpaces;
 
     //cache this here (set by SetInitialized)
     size_t _m_nr_agents;
@@ -84,6 +87,10 @@ private:
 
     /// The stepsize array - used for indiv->joint index calculation.
     size_t * _m_actionStepSize;
+    /// The stepsize array for observations.
+    size_t * _m_observationStepSize;
+    /// The stepsize array for states.
+    size_t * _m_stateStepSize;
 
     /**Vector that stores the number of individual states. (Created by
      * CreateJointStates() )*/
@@ -92,10 +99,9 @@ private:
     /**The vector storing the individual state indices for each joint
      * index: _m_indivStateIndices[jointStateIndex] = vector<Index> */
     std::vector< std::vector<Index> > _m_indivStateIndices;
-    std::map< Index, std::vector<Index> > *_m_indivStateIndicesMap;
     
     std::vector<State*> _m_jointStates;
-    std::map<std::vector<Index>, State*> *_m_jointStatesMap;
+    std::map<Index, State*> *_m_jointStatesMap;
     
     size_t _m_nrJointStates;
 
@@ -204,6 +210,17 @@ public:
     /**\brief Sets the initial state distribution to v.*/
     void SetISD(const std::vector<double> &v);
 
+    /**\brief Indicate whether the joint states, actions and
+     * observations should be created lazily.
+     *
+     * In that case no joint models are generated, as is always the
+     * case for more than 2 agents: joint <-> individual conversions
+     * use the step sizes, and joint objects are only created when
+     * asked for (typically for printing). Only has effect before
+     * the class has been initialized. */
+    void SetLazyJointSpaces(bool lazy)
+        { _m_lazyJointSpaces=lazy; }
+
     //get (data) functions:   
     /**Returns a pointer to agentsI's individual model.
      */
@@ -244,15 +261,24 @@ public:
 //                    _m_nrActions);}
     /**\brief returns a vector of indices to indiv. action indicies corr.
      * to joint action index jaI.*/
-    const std::vector<Index>& JointToIndividualActionIndices(Index jaI) const {
-        return(_m_jointToIndActionCache.at(jaI)); }
+    std::vector<Index> JointToIndividualActionIndices(Index jaI) const;
+    /**\brief writes the indiv. action indices corr. to joint action
+     * index jaI to AI_ar.*/
+    void JointToIndividualActionIndices(Index jaI, Index* AI_ar) const
+        {IndexTools::JointToIndividualIndicesArrayStepSize(
+             jaI, _m_actionStepSize, _m_nr_agents, AI_ar);}
     Index IndividualToJointActionIndices(const Index* AI_ar) const
         {return IndexTools::IndividualToJointIndicesArrayStepSize(
              AI_ar, _m_actionStepSize, _m_nr_agents);}
 
     /**\brief returns a vector of individual (local) state indices
      * corresponding to joint state index jointSI.*/
-    const std::vector<Index>& JointToIndividualStateIndices(Index jointSI) const;
+    std::vector<Index> JointToIndividualStateIndices(Index jointSI) const;
+    /**\brief writes the individual (local) state indices corresponding
+     * to joint state index jointSI to SI_ar.*/
+    void JointToIndividualStateIndices(Index jointSI, Index* SI_ar) const
+        {IndexTools::JointToIndividualIndicesArrayStepSize(
+             jointSI, _m_stateStepSize, _m_nr_agents, SI_ar);}
 
     /**\brief returns the joint index for indivStateIndices*/
     Index IndividualToJointStateIndices(const std::vector<Index>&
@@ -262,9 +288,13 @@ public:
     Index IndividualToJointObservationIndices(const std::vector<Index>& 
                                                indivObsIndices) const;
     /**\brief returns the individual indices for joint observation joI.*/
-    const std::vector<Index>& JointToIndividualObservationIndices(Index joI) 
-        const
-        { return(_m_jointToIndObsCache.at(joI)); }
+    std::vector<Index> JointToIndividualObservationIndices(Index joI) 
+        const;
+    /**\brief writes the individual indices for joint observation joI
+     * to OI_ar.*/
+    void JointToIndividualObservationIndices(Index joI, Index* OI_ar) const
+        {IndexTools::JointToIndividualIndicesArrayStepSize(
+             joI, _m_observationStepSize, _m_nr_agents, OI_ar);}
 
     /**\brief SoftPrints the action set for each agent.*/ 
     std::string SoftPrintActionSets() const;
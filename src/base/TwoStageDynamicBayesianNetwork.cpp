@@ -0,0 +1,338 @@
+/**\file TwoStageDynamicBayesianNetwork.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include <stdlib.h>
+#include <sstream>
+#include "TwoStageDynamicBayesianNetwork.h"
+#include "E.h"
+#include "PrintTools.h"
+
+using namespace std;
+
+TwoStageDynamicBayesianNetwork::TwoStageDynamicBayesianNetwork(
+    const vector<size_t>& nrValsPerSF,
+    const vector<size_t>& nrActions,
+    const vector<size_t>& nrObservations) :
+    _m_nrVals(nrValsPerSF),
+    _m_nrActions(nrActions),
+    _m_nrObservations(nrObservations),
+    _m_XSoI_Y(nrValsPerSF.size()),
+    _m_ASoI_Y(nrValsPerSF.size()),
+    _m_CPT_Y(nrValsPerSF.size()),
+    _m_XOffset_Y(nrValsPerSF.size()),
+    _m_AOffset_Y(nrValsPerSF.size()),
+    _m_YSoI_O(nrActions.size()),
+    _m_ASoI_O(nrActions.size()),
+    _m_CPT_O(nrActions.size()),
+    _m_YOffset_O(nrActions.size()),
+    _m_AOffset_O(nrActions.size())
+{
+    if(nrActions.size() != nrObservations.size())
+        throw E("TwoStageDynamicBayesianNetwork: nrActions and nrObservations should have a size equal to the number of agents");
+
+    _m_stateStepSize = StepSize(_m_nrVals);
+    _m_actionStepSize = StepSize(_m_nrActions);
+    _m_observationStepSize = StepSize(_m_nrObservations);
+    _m_nrStates = 1;
+    for(Index y=0; y < _m_nrVals.size(); y++)
+        _m_nrStates *= _m_nrVals[y];
+
+    // empty scopes, such that each CPT has a single row
+    for(Index y=0; y < _m_nrVals.size(); y++)
+        SetScopeY(y, vector<Index>(), vector<Index>());
+    for(Index agI=0; agI < _m_nrObservations.size(); agI++)
+        SetScopeO(agI, vector<Index>(), vector<Index>());
+}
+
+vector<size_t>
+TwoStageDynamicBayesianNetwork::StepSize(const vector<size_t>& nrElems)
+{
+    // the last element changes fastest
+    vector<size_t> stepSize(nrElems.size());
+    size_t step = 1;
+    for(Index i = nrElems.size(); i > 0; i--)
+    {
+        stepSize[i-1] = step;
+        step *= nrElems[i-1];
+    }
+    return(stepSize);
+}
+
+size_t TwoStageDynamicBayesianNetwork::GetNrJointActions() const
+{
+    size_t nrJA = 1;
+    for(Index agI=0; agI < _m_nrActions.size(); agI++)
+        nrJA *= _m_nrActions[agI];
+    return(nrJA);
+}
+
+size_t TwoStageDynamicBayesianNetwork::GetNrJointObservations() const
+{
+    size_t nrJO = 1;
+    for(Index agI=0; agI < _m_nrObservations.size(); agI++)
+        nrJO *= _m_nrObservations[agI];
+    return(nrJO);
+}
+
+void TwoStageDynamicBayesianNetwork::SetScopeY(Index y,
+                                               const vector<Index>& XSoI,
+                                               const vector<Index>& ASoI)
+{
+    _m_XSoI_Y.at(y) = XSoI;
+    _m_ASoI_Y.at(y) = ASoI;
+    vector<size_t> domain = GetParentDomainY(y);
+    size_t nrRows = 1;
+    for(Index i=0; i < domain.size(); i++)
+        nrRows *= domain[i];
+    _m_CPT_Y[y].assign(nrRows * _m_nrVals[y], 0.0);
+    ComputeParentOffsets(XSoI, ASoI, _m_XOffset_Y[y], _m_AOffset_Y[y]);
+}
+
+void TwoStageDynamicBayesianNetwork::SetScopeO(Index agI,
+                                               const vector<Index>& YSoI,
+                                               const vector<Index>& ASoI)
+{
+    _m_YSoI_O.at(agI) = YSoI;
+    _m_ASoI_O.at(agI) = ASoI;
+    vector<size_t> domain = GetParentDomainO(agI);
+    size_t nrRows = 1;
+    for(Index i=0; i < domain.size(); i++)
+        nrRows *= domain[i];
+    _m_CPT_O[agI].assign(nrRows * _m_nrObservations[agI], 0.0);
+    ComputeParentOffsets(YSoI, ASoI, _m_YOffset_O[agI], _m_AOffset_O[agI]);
+}
+
+void TwoStageDynamicBayesianNetwork::ComputeParentOffsets(
+    const vector<Index>& SFSoI, const vector<Index>& ASoI,
+    vector<Index>& sfOffset, vector<Index>& aOffset) const
+{
+    // the parents index is (state factor part) * nrARows + (action part)
+    size_t nrJA = GetNrJointActions();
+    size_t nrARows = 1;
+    for(Index i=0; i < ASoI.size(); i++)
+        nrARows *= _m_nrActions.at(ASoI[i]);
+
+    aOffset.resize(nrJA);
+    for(Index jaI=0; jaI < nrJA; jaI++)
+    {
+        Index pI = 0;
+        for(Index i=0; i < ASoI.size(); i++)
+            pI = pI * _m_nrActions[ASoI[i]] + GetActionIndex(jaI, ASoI[i]);
+        aOffset[jaI] = pI;
+    }
+
+    sfOffset.resize(_m_nrStates);
+    for(Index sI=0; sI < _m_nrStates; sI++)
+    {
+        Index pI = 0;
+        for(Index i=0; i < SFSoI.size(); i++)
+            pI = pI * _m_nrVals.at(SFSoI[i]) +
+                GetStateFactorValue(sI, SFSoI[i]);
+        sfOffset[sI] = pI * nrARows;
+    }
+}
+
+vector<size_t> TwoStageDynamicBayesianNetwork::GetParentDomainY(Index y) const
+{
+    vector<size_t> domain;
+    for(Index i=0; i < _m_XSoI_Y.at(y).size(); i++)
+        domain.push_back(_m_nrVals.at(_m_XSoI_Y[y][i]));
+    for(Index i=0; i < _m_ASoI_Y.at(y).size(); i++)
+        domain.push_back(_m_nrActions.at(_m_ASoI_Y[y][i]));
+    return(domain);
+}
+
+vector<size_t> TwoStageDynamicBayesianNetwork::GetParentDomainO(Index agI)
+    const
+{
+    vector<size_t> domain;
+    for(Index i=0; i < _m_YSoI_O.at(agI).size(); i++)
+        domain.push_back(_m_nrVals.at(_m_YSoI_O[agI][i]));
+    for(Index i=0; i < _m_ASoI_O.at(agI).size(); i++)
+        domain.push_back(_m_nrActions.at(_m_ASoI_O[agI][i]));
+    return(domain);
+}
+
+Index TwoStageDynamicBayesianNetwork::GetParentsIndex(
+    const vector<Index>& parentVals, const vector<size_t>& domain)
+{
+    if(parentVals.size() != domain.size())
+        throw E("TwoStageDynamicBayesianNetwork: wrong number of parent values");
+    Index pI = 0;
+    for(Index i=0; i < domain.size(); i++)
+    {
+        if(parentVals[i] >= domain[i])
+            throw E("TwoStageDynamicBayesianNetwork: parent value out of range");
+        pI = pI * domain[i] + parentVals[i];
+    }
+    return(pI);
+}
+
+void TwoStageDynamicBayesianNetwork::SetYProbability(Index y,
+    const vector<Index>& parentVals, Index yVal, double p)
+{
+    Index pI = GetParentsIndex(parentVals, GetParentDomainY(y));
+    _m_CPT_Y[y].at(pI * _m_nrVals[y] + yVal) = p;
+}
+
+void TwoStageDynamicBayesianNetwork::SetOProbability(Index agI,
+    const vector<Index>& parentVals, Index oVal, double p)
+{
+    Index pI = GetParentsIndex(parentVals, GetParentDomainO(agI));
+    _m_CPT_O[agI].at(pI * _m_nrObservations[agI] + oVal) = p;
+}
+
+double TwoStageDynamicBayesianNetwork::GetTransitionProbability(Index sI,
+    Index jaI, Index sucSI) const
+{
+    double p = 1.0;
+    for(Index y=0; y < _m_nrVals.size() && p > 0.0; y++)
+        p *= GetYProbability(y, sI, jaI, GetStateFactorValue(sucSI, y));
+    return(p);
+}
+
+double TwoStageDynamicBayesianNetwork::GetObservationProbability(Index jaI,
+    Index sucSI, Index joI) const
+{
+    double p = 1.0;
+    for(Index agI=0; agI < _m_nrObservations.size() && p > 0.0; agI++)
+        p *= GetOProbability(agI, jaI, sucSI,
+                             Value(joI, _m_observationStepSize,
+                                   _m_nrObservations, agI));
+    return(p);
+}
+
+Index TwoStageDynamicBayesianNetwork::Sample(const vector<double>& cpt,
+                                             Index offset, size_t nr)
+{
+    double randNr=rand() / (RAND_MAX + 1.0);
+
+    double sum=0;
+    for(Index v=0; v < nr; v++)
+    {
+        sum+=cpt[offset+v];
+        if(randNr<=sum)
+            return(v);
+    }
+    return(0);
+}
+
+Index TwoStageDynamicBayesianNetwork::SampleSuccessorState(Index sI,
+                                                           Index jaI) const
+{
+    Index sucSI = 0;
+    for(Index y=0; y < _m_nrVals.size(); y++)
+    {
+        Index yVal = Sample(_m_CPT_Y[y],
+                            GetParentsIndexY(y, sI, jaI) * _m_nrVals[y],
+                            _m_nrVals[y]);
+        sucSI += yVal * _m_stateStepSize[y];
+    }
+    return(sucSI);
+}
+
+Index TwoStageDynamicBayesianNetwork::SampleJointObservation(Index jaI,
+                                                             Index sucSI)
+    const
+{
+    Index joI = 0;
+    for(Index agI=0; agI < _m_nrObservations.size(); agI++)
+    {
+        size_t nrO = _m_nrObservations[agI];
+        Index oI = Sample(_m_CPT_O[agI],
+                          GetParentsIndexO(agI, jaI, sucSI) * nrO, nrO);
+        joI += oI * _m_observationStepSize[agI];
+    }
+    return(joI);
+}
+
+void TwoStageDynamicBayesianNetwork::CheckCPT(const vector<double>& cpt,
+                                              size_t nr,
+                                              const string& what) const
+{
+    for(Index row=0; row < cpt.size() / nr; row++)
+    {
+        double sum = 0.0;
+        for(Index v=0; v < nr; v++)
+        {
+            double p = cpt[row*nr + v];
+            if(p < 0)
+            {
+                stringstream ss;
+                ss << "TwoStageDynamicBayesianNetwork::SanityCheck failed: "
+                   << "negative probability " << p << " in CPT of " << what
+                   << " (row " << row << ")";
+                throw E(ss);
+            }
+            sum += p;
+        }
+        if((sum>(1.0 + PROB_PRECISION/2)) ||
+           (sum < (1.0 - PROB_PRECISION/2)))
+        {
+            stringstream ss;
+            ss << "TwoStageDynamicBayesianNetwork::SanityCheck failed: CPT of "
+               << what << " does not sum to 1 but to " << sum 
+               << " (row " << row << ")";
+            throw E(ss);
+        }
+    }
+}
+
+bool TwoStageDynamicBayesianNetwork::SanityCheck() const
+{
+    for(Index y=0; y < _m_nrVals.size(); y++)
+    {
+        stringstream ss;
+        ss << "state factor " << y;
+        CheckCPT(_m_CPT_Y[y], _m_nrVals[y], ss.str());
+    }
+    for(Index agI=0; agI < _m_nrObservations.size(); agI++)
+    {
+        stringstream ss;
+        ss << "observation of agent " << agI;
+        CheckCPT(_m_CPT_O[agI], _m_nrObservations[agI], ss.str());
+    }
+    return(true);
+}
+
+string TwoStageDynamicBayesianNetwork::SoftPrint() const
+{
+    stringstream ss;
+    ss << "TwoStageDynamicBayesianNetwork with " << _m_nrVals.size()
+       << " state factors (nrVals=" << SoftPrintVector(_m_nrVals) << ")"
+       << endl;
+    for(Index y=0; y < _m_nrVals.size(); y++)
+        ss << "y" << y << ": X-scope " << SoftPrintVector(_m_XSoI_Y[y])
+           << ", A-scope " << SoftPrintVector(_m_ASoI_Y[y])
+           << ", CPT size " << _m_CPT_Y[y].size() << endl;
+    for(Index agI=0; agI < _m_nrObservations.size(); agI++)
+        ss << "o" << agI << ": Y-scope " << SoftPrintVector(_m_YSoI_O[agI])
+           << ", A-scope " << SoftPrintVector(_m_ASoI_O[agI])
+           << ", CPT size " << _m_CPT_O[agI].size() << endl;
+    return(ss.str());
+}
+
@@ -0,0 +1,209 @@
+/**\file TwoStageDynamicBayesianNetwork.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _TWOSTAGEDYNAMICBAYESIANNETWORK_H_
+#define _TWOSTAGEDYNAMICBAYESIANNETWORK_H_ 1
+
+/* the include directives */
+#include <vector>
+#include <string>
+#include "Globals.h"
+
+/**\brief TwoStageDynamicBayesianNetwork (2DBN) is a factored
+ * representation of the transition and observation model of a
+ * discrete MADP.
+ *
+ * The state consists of state factors. The value of each state factor
+ * y at the next stage depends only on a scope of state factors at the
+ * current stage and on a scope of agents (whose actions are used).
+ * Similarly, the observation of each agent depends only on a scope of
+ * state factors at the next stage, and on a scope of agents.
+ *
+ * For each state factor and each agent a conditional probability
+ * table (CPT) is stored, indexed by the values of its scope. The
+ * probabilities of joint states and joint observations (as used by
+ * TransitionModel2DBN and ObservationModel2DBN) are computed from
+ * these CPTs on demand, and are never stored. To make this fast, the
+ * (state factor and action) parts of the parent index of each CPT are
+ * tabulated per joint state and joint action, which takes memory
+ * linear in the number of states and joint actions.
+ *
+ * Joint state, action and observation indices are interpreted as in
+ * IndexTools::IndividualToJointIndices(), i.e., the last factor (or
+ * agent) changes fastest.
+ */
+class TwoStageDynamicBayesianNetwork 
+{
+private:
+    ///The number of values of each state factor.
+    std::vector<size_t> _m_nrVals;
+    ///The number of actions of each agent.
+    std::vector<size_t> _m_nrActions;
+    ///The number of observations of each agent.
+    std::vector<size_t> _m_nrObservations;
+    ///Step sizes for joint state, action and observation indices.
+    std::vector<size_t> _m_stateStepSize;
+    std::vector<size_t> _m_actionStepSize;
+    std::vector<size_t> _m_observationStepSize;
+    ///The total number of joint states.
+    size_t _m_nrStates;
+
+    ///For each state factor y: the state factors at the previous stage
+    ///that y depends on.
+    std::vector< std::vector<Index> > _m_XSoI_Y;
+    ///For each state factor y: the agents whose actions y depends on.
+    std::vector< std::vector<Index> > _m_ASoI_Y;
+    ///For each state factor y: P(y|X,A) as [parentsI*_m_nrVals[y] + y].
+    std::vector< std::vector<double> > _m_CPT_Y;
+    ///For each state factor y: the part of parentsI that depends on sI.
+    std::vector< std::vector<Index> > _m_XOffset_Y;
+    ///For each state factor y: the part of parentsI that depends on jaI.
+    std::vector< std::vector<Index> > _m_AOffset_Y;
+
+    ///For each agent: the next-stage state factors its observation
+    ///depends on.
+    std::vector< std::vector<Index> > _m_YSoI_O;
+    ///For each agent: the agents whose actions its observation depends on.
+    std::vector< std::vector<Index> > _m_ASoI_O;
+    ///For each agent: P(o|Y,A) as [parentsI*_m_nrObservations[i] + o].
+    std::vector< std::vector<double> > _m_CPT_O;
+    ///For each agent: the part of parentsI that depends on sucSI.
+    std::vector< std::vector<Index> > _m_YOffset_O;
+    ///For each agent: the part of parentsI that depends on jaI.
+    std::vector< std::vector<Index> > _m_AOffset_O;
+
+    static std::vector<size_t> StepSize(const std::vector<size_t>& nrElems);
+    static Index Value(Index jointI, const std::vector<size_t>& stepSize,
+                       const std::vector<size_t>& nrElems, Index i)
+    { return((jointI / stepSize[i]) % nrElems[i]); }
+
+    ///Tabulates the parts of the parents index of a scope (see
+    ///_m_XOffset_Y and _m_AOffset_Y).
+    void ComputeParentOffsets(const std::vector<Index>& SFSoI,
+                              const std::vector<Index>& ASoI,
+                              std::vector<Index>& sfOffset,
+                              std::vector<Index>& aOffset) const;
+    ///Returns the index of the parents of y, given joint indices.
+    Index GetParentsIndexY(Index y, Index sI, Index jaI) const
+    { return(_m_XOffset_Y[y][sI] + _m_AOffset_Y[y][jaI]); }
+    ///Returns the index of the parents of o_agI, given joint indices.
+    Index GetParentsIndexO(Index agI, Index jaI, Index sucSI) const
+    { return(_m_YOffset_O[agI][sucSI] + _m_AOffset_O[agI][jaI]); }
+    ///Returns the index of the parents given a vector of their values.
+    static Index GetParentsIndex(const std::vector<Index>& parentVals,
+                                 const std::vector<size_t>& domain);
+    ///Samples from the distribution stored in cpt[offset...offset+nr-1].
+    static Index Sample(const std::vector<double>& cpt, Index offset,
+                        size_t nr);
+    void CheckCPT(const std::vector<double>& cpt, size_t nr,
+                  const std::string& what) const;
+
+protected:
+
+public:
+    // Constructor, destructor and copy assignment.
+    /**\brief Constructor, taking the number of values of each state
+     * factor, and the number of actions and observations of each
+     * agent.
+     *
+     * All state factors and observations have an empty scope and
+     * an all-zero CPT: SetScopeY() and SetScopeO() should be called,
+     * followed by filling the CPTs.*/
+    TwoStageDynamicBayesianNetwork(const std::vector<size_t>& nrValsPerSF,
+                                   const std::vector<size_t>& nrActions,
+                                   const std::vector<size_t>& nrObservations);
+
+    ///Sets the scope of state factor y, and allocates its CPT.
+    void SetScopeY(Index y, const std::vector<Index>& XSoI,
+                   const std::vector<Index>& ASoI);
+    ///Sets the scope of the observation of agent agI, and allocates its CPT.
+    void SetScopeO(Index agI, const std::vector<Index>& YSoI,
+                   const std::vector<Index>& ASoI);
+
+    ///Returns the domain sizes of the parents of y, first X then A.
+    std::vector<size_t> GetParentDomainY(Index y) const;
+    ///Returns the domain sizes of the parents of o_agI, first Y then A.
+    std::vector<size_t> GetParentDomainO(Index agI) const;
+
+    ///Sets P(y=yVal | parents) where parentVals are ordered as in
+    ///GetParentDomainY().
+    void SetYProbability(Index y, const std::vector<Index>& parentVals,
+                         Index yVal, double p);
+    ///Sets P(o_agI=oVal | parents) where parentVals are ordered as in
+    ///GetParentDomainO().
+    void SetOProbability(Index agI, const std::vector<Index>& parentVals,
+                         Index oVal, double p);
+
+    ///Returns P(y=yVal | sI, jaI) for a single state factor y.
+    double GetYProbability(Index y, Index sI, Index jaI, Index yVal) const
+    { return(_m_CPT_Y[y][GetParentsIndexY(y, sI, jaI)*_m_nrVals[y]+yVal]); }
+    ///Returns P(o_agI=oVal | jaI, sucSI) for a single agent.
+    double GetOProbability(Index agI, Index jaI, Index sucSI, Index oVal)
+        const
+    { return(_m_CPT_O[agI][GetParentsIndexO(agI, jaI, sucSI)*
+                           _m_nrObservations[agI]+oVal]); }
+
+    ///Returns P(sucSI | sI, jaI), the product over all state factors.
+    double GetTransitionProbability(Index sI, Index jaI, Index sucSI) const;
+    ///Returns P(joI | jaI, sucSI), the product over all agents.
+    double GetObservationProbability(Index jaI, Index sucSI, Index joI)
+        const;
+    ///Samples a successor state, one state factor at a time.
+    Index SampleSuccessorState(Index sI, Index jaI) const;
+    ///Samples a joint observation, one agent at a time.
+    Index SampleJointObservation(Index jaI, Index sucSI) const;
+
+    ///Returns the value of state factor y in joint state sI.
+    Index GetStateFactorValue(Index sI, Index y) const
+    { return(Value(sI, _m_stateStepSize, _m_nrVals, y)); }
+    ///Returns the action of agent agI in joint action jaI.
+    Index GetActionIndex(Index jaI, Index agI) const
+    { return(Value(jaI, _m_actionStepSize, _m_nrActions, agI)); }
+
+    size_t GetNrStateFactors() const { return(_m_nrVals.size()); }
+    size_t GetNrStates() const { return(_m_nrStates); }
+    size_t GetNrAgents() const { return(_m_nrActions.size()); }
+    size_t GetNrJointActions() const;
+    size_t GetNrJointObservations() const;
+
+    /**\brief Checks that every row of every CPT is a probability
+     * distribution.
+     *
+     * This implies that the transition and observation model are
+     * proper, without enumerating joint states. Throws E otherwise.*/
+    bool SanityCheck() const;
+
+    std::string SoftPrint() const;
+};
+
+
+#endif /* !_TWOSTAGEDYNAMICBAYESIANNETWORK_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -37,6 +37,7 @@
 #include "Timing.h"
 #include "SimulationDecPOMDPDiscrete.h"
 #include "SimulationResult.h"
+#include "PolicyCache.h"
 
 #include "argumentHandlers.h"
 #include "argumentUtils.h"
@@ -98,13 +99,20 @@ int main(int argc, char **argv)
     PlanningUnitDecPOMDPDiscrete* jesp = 0;
     if(args.jesp == JESPtype::JESPExhaustive)
     {
-        jesp = new JESPExhaustivePlanner (params,horizon,&decpomdp);
+        JESPExhaustivePlanner* jespExh =
+            new JESPExhaustivePlanner (params,horizon,&decpomdp);
+        jespExh->SetNrRestarts(restarts);
+        jesp = jespExh;
         if(args.verbose >= 0)
             cout << "JESPExhaustivePlanner initialized" << endl;
     }
     else if(args.jesp == JESPtype::JESPDP)
     {
-        jesp = new JESPDynamicProgrammingPlanner (params,horizon,&decpomdp);
+        JESPDynamicProgrammingPlanner* jespDP =
+            new JESPDynamicProgrammingPlanner (params,horizon,&decpomdp);
+        jespDP->SetNrRestarts(restarts);
+        jespDP->SetUseClustering(args.clustering);
+        jesp = jespDP;
         if(args.verbose >= 0)
             cout << "JESPDynamicProgrammingPlanner initialized" << endl;
     }
@@ -112,35 +120,54 @@ int main(int argc, char **argv)
     if(args.verbose >= 0)
         cout << "JESP Planner initialized" << endl;
 
-    for(int restartI = 0; restartI < restarts; restartI++)
-    {
-        //start all timers:
-        Time.Start("Plan");
+    //the restarts are performed (in parallel) by the planner itself,
+    //which keeps the best policy found
+    Time.Start("Plan");
 
+    double V;
+    PolicyCache *cache=0;
+    string key;
+    if(args.usePolicyCache)
+    {
+        cache=new PolicyCache();
+        stringstream ss;
+        ss << "JESP " << args.jesp << " h=" << horizon
+           << " restarts=" << restarts;
+        key=PolicyCache::GetKey(decpomdp,ss.str());
+    }
+    if(cache!=0 && cache->LoadJointPolicy(key,*jesp->GetJointPolicyPureVector(),V))
+    {
+        if(args.verbose >= 0)
+            cout << "Joint policy found in the policy cache" << endl;
+    }
+    else
+    {
         jesp->Plan();
-        double V = jesp->GetExpectedReward();
-        cout << "value="<< V << endl;
-        if(args.verbose >= 1) 
-        {
-            jesp->GetJointPolicyPureVector()->Print();
-            cout <<  endl;
-        }
+        V = jesp->GetExpectedReward();
+        if(cache!=0)
+            cache->SaveJointPolicy(key,*jesp->GetJointPolicyPureVector(),V);
+    }
+    delete cache;
+    cout << "value="<< V << endl;
+    if(args.verbose >= 1) 
+    {
+        jesp->GetJointPolicyPureVector()->Print();
+        cout <<  endl;
+    }
 
-        Time.Stop("Plan");
+    Time.Stop("Plan");
 
 #if CHECK_RESULT
-        ValueFunctionDecPOMDPDiscrete vf(jesp, jesp->GetJointPolicyPureVector());
-        double v = vf.CalculateV(true);
-        cout << "Validated value (exact/approx):="<<v;
-        SimulationDecPOMDPDiscrete sim(*jesp, 1000);
-        SimulationResult simres = 
-            sim.RunSimulations( jesp->GetJointPolicyPureVector() );
-        v = simres.GetAvgReward();
-        cout << " / "<<v <<endl;
+    ValueFunctionDecPOMDPDiscrete vf(jesp, jesp->GetJointPolicyPureVector());
+    double v = vf.CalculateV(true);
+    cout << "Validated value (exact/approx):="<<v;
+    SimulationDecPOMDPDiscrete sim(*jesp, 1000);
+    SimulationResult simres = 
+        sim.RunSimulations( jesp->GetJointPolicyPureVector() );
+    v = simres.GetAvgReward();
+    cout << " / "<<v <<endl;
 #endif
 
-    }
-
     delete jesp;
     
     Time.Stop("Overall");
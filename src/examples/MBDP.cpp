@@ -0,0 +1,136 @@
+/**\file MBDP.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: MBDP.cpp 3637 2009-08-31 12:47:58Z mtjspaan $
+ */
+
+#define CHECK_RESULT 0
+
+#include <time.h>
+#include <sys/times.h>
+#include <iostream>
+#include <fstream>
+#include <float.h>
+#include "MBDPPlanner.h"
+#include "PolicyAutomaton.h"
+#include "Timing.h"
+#include "SimulationDecPOMDPDiscrete.h"
+#include "SimulationResult.h"
+
+#include "argumentHandlers.h"
+#include "argumentUtils.h"
+
+using namespace std;
+using namespace ArgumentUtils;
+
+#pragma comment(lib,"libMADPplanning.lib")  
+#pragma comment(lib,"libMADPSupport.lib") 
+
+const char *argp_program_version = "MBDP";
+
+// Program documentation
+static char doc[] =
+"MBDP - runs the MBDP (Memory-Bounded Dynamic Programming) planner\
+\v";
+
+//NOTE: make sure that the below value (nrChildParsers) is correct!
+const int nrChildParsers = 5;
+const struct argp_child childVector[] = {
+    ArgumentHandlers::problemFile_child,
+    ArgumentHandlers::globalOptions_child,
+    ArgumentHandlers::modelOptions_child,
+    ArgumentHandlers::solutionMethodOptions_child,
+    ArgumentHandlers::MBDP_child,
+    { 0 }
+};
+
+#include "argumentHandlersPostChild.h"
+
+int main(int argc, char **argv)
+{
+    ArgumentHandlers::Arguments args;
+    argp_parse (&ArgumentHandlers::theArgpStruc, argc, argv, 0, 0, &args);
+
+    srand(time(0));
+
+    int horizon=args.horizon;
+
+    try {
+    //start timers
+    Timing Time;    
+    Time.Start("Overall");
+
+    DecPOMDPDiscreteInterface & decpomdp = * GetDecPOMDPDiscreteInterfaceFromArgs(args);
+    
+    //Initialization of the planner with typical options for MBDP: the
+    //policy trees are bounded in size, so the (exponentially many)
+    //histories are not computed
+    Time.Start("PlanningUnit");
+    PlanningUnitMADPDiscreteParameters params;
+    params.SetComputeAll(false);
+    if(args.sparse)
+        params.SetUseSparseJointBeliefs(true);
+    else
+        params.SetUseSparseJointBeliefs(false);
+    MBDPPlanner* mbdp = new MBDPPlanner(params, horizon, &decpomdp,
+                                        args.MBDPmaxTrees,
+                                        args.MBDPexploration);
+    Time.Stop("PlanningUnit");
+    if(args.verbose >= 0)
+        cout << "MBDP Planner initialized" << endl;
+
+    for(int restartI = 0; restartI < args.MBDPnrRestarts; restartI++)
+    {
+        Time.Start("Plan");
+        mbdp->Plan();
+        Time.Stop("Plan");
+
+        double V = mbdp->GetExpectedReward();
+        cout << "value="<< V << endl;
+        if(args.verbose >= 1) 
+        {
+            mbdp->GetPolicyAutomaton().Print();
+            cout <<  endl;
+        }
+
+#if CHECK_RESULT
+        SimulationDecPOMDPDiscrete sim(*mbdp, 1000);
+        SimulationResult simres = 
+            sim.RunSimulations( mbdp->GetJointPolicyPureVector() );
+        cout << "Simulated value:=" << simres.GetAvgReward() << endl;
+#endif
+    }
+
+    delete mbdp;
+    
+    Time.Stop("Overall");
+
+    if(args.verbose >= 0)
+    {
+        Time.PrintSummary();
+    }
+
+    }
+    catch(E& e){ e.Print(); }
+}
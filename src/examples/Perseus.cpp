@@ -176,6 +176,8 @@ int main(int argc, char **argv)
         P->SetSaveTimings(true);
     if(args.computeVectorForEachBelief)
         P->SetComputeVectorForEachBelief(true);
+    if(args.lazyBackProjection)
+        P->SetLazyBackProjection(true);
     if(args.dryrun)
         P->SetDryrun(true);
         
@@ -32,17 +32,24 @@
 #include "BayesianGameIdenticalPayoff.h"
 #include "JointPolicyPureVector.h"
 #include "QFunctionJAOHInterface.h"
+#include "JointBeliefTracker.h"
 
 using namespace std;
 
 #define DEBUG_AgentBG 0
 
 AgentBG::AgentBG(const PlanningUnitDecPOMDPDiscrete &pu, Index id,
-                 QAV<PerseusBGPlanner> *QBG) :
+                 QAV<PerseusBGPlanner> *QBG,
+                 JointBeliefTracker *jbTracker) :
     AgentDelayedSharedObservations(pu,id),
     _m_QBG(QBG),
-    _m_t(0)
+    _m_t(0),
+    _m_jbTracker(jbTracker),
+    _m_ownJBTracker(jbTracker==0),
+    _m_avIndex(QBG->GetPlanner()->GetQFunctions())
 {
+    if(_m_ownJBTracker)
+        _m_jbTracker=new JointBeliefTracker(pu);
     _m_bgip=new BayesianGameIdenticalPayoff(pu.GetNrAgents(),
                                             pu.GetReferred()->GetNrActions(), 
                                             pu.GetReferred()->
@@ -57,7 +64,9 @@ AgentBG::AgentBG(const AgentBG& a) :
     AgentDelayedSharedObservations(a),
     _m_QBG(a._m_QBG), // share the QBG, just copy the pointer
     _m_t(a._m_t),
-    _m_prevJB(a._m_prevJB),
+    _m_jbTracker(a._m_jbTracker), // share the tracker, unless a owns it
+    _m_ownJBTracker(a._m_ownJBTracker),
+    _m_avIndex(a._m_avIndex),
     _m_oIs(a._m_oIs),
     _m_prevJoIs(a._m_prevJoIs),
     _m_prevJaIs(a._m_prevJaIs),
@@ -66,11 +75,15 @@ AgentBG::AgentBG(const AgentBG& a) :
 {
     _m_bgip=new BayesianGameIdenticalPayoff(*a._m_bgip);
     _m_jpol=new JointPolicyPureVector(*a._m_jpol);
+    if(_m_ownJBTracker)
+        _m_jbTracker=new JointBeliefTracker(*a._m_jbTracker);
 }
 
 //Destructor
 AgentBG::~AgentBG()
 {
+    if(_m_ownJBTracker)
+        delete _m_jbTracker;
     delete _m_bgip;
     delete _m_jpol;
 }
@@ -93,9 +106,7 @@ Index AgentBG::Act(Index oI, Index prevJoI)
     case 0: // we know joint belief at t=0, namely the ISD, so we can
             // use the POMDP action
     {
-        JointBeliefInterface* jbi = GetPU()->GetNewJointBeliefFromISD();
-        Index ja=GetMaximizingActionIndex(*jbi);
-        delete jbi;
+        Index ja=GetMaximizingActionIndex(_m_jbTracker->GetJointBelief(0));
         vector<Index> aIs=GetPU()->JointToIndividualActionIndices(ja);
         aI=aIs[GetIndex()];
         _m_jaIfirst=ja;
@@ -107,9 +118,7 @@ Index AgentBG::Act(Index oI, Index prevJoI)
     case 1: // at t=1, the previous joint belief is the ISD, but now
             // we use the BG policy
     {
-        JointBeliefInterface* jbi = GetPU()->GetNewJointBeliefFromISD();
-        betaMaxI=GetMaximizingBGIndex(*jbi);
-        delete jbi;
+        betaMaxI=GetMaximizingBGIndex(_m_jbTracker->GetJointBelief(0));
 
         _m_jpol->SetIndex(betaMaxI);
         aI=_m_jpol->GetActionIndex(GetIndex(),oI);
@@ -118,9 +127,8 @@ Index AgentBG::Act(Index oI, Index prevJoI)
     case 2: // now we start updating the previous joint beliefs, using
             // the joint action we took at t=0
     {
-        _m_prevJB.Update(*GetPU()->GetReferred(),_m_jaIfirst,prevJoI);
-
-        betaMaxI=GetMaximizingBGIndex(_m_prevJB);
+        betaMaxI=GetMaximizingBGIndex(
+            _m_jbTracker->GetJointBelief(1,_m_jaIfirst,prevJoI));
 
         _m_jpol->SetIndex(betaMaxI);
         aI=_m_jpol->GetActionIndex(GetIndex(),oI);
@@ -129,10 +137,10 @@ Index AgentBG::Act(Index oI, Index prevJoI)
     default: // the rest of the time we use the previous BG jpol to
              // get the joint action to update the joint belief
     {
-        _m_prevJB.Update(*GetPU()->GetReferred(),_m_jpol->GetJointActionIndex(prevJoI),
-                         prevJoI);
-
-        betaMaxI=GetMaximizingBGIndex(_m_prevJB);
+        betaMaxI=GetMaximizingBGIndex(
+            _m_jbTracker->GetJointBelief(_m_t-1,
+                                         _m_jpol->GetJointActionIndex(prevJoI),
+                                         prevJoI));
 
         _m_jpol->SetIndex(betaMaxI);
         aI=_m_jpol->GetActionIndex(GetIndex(),oI);
@@ -161,10 +169,6 @@ Index AgentBG::Act(Index oI, Index prevJoI)
 void AgentBG::ResetEpisode()
 {
     _m_t=0;
-
-    JointBeliefInterface* jbi = GetPU()->GetNewJointBeliefFromISD();
-    _m_prevJB.Set(jbi->Get());
-    delete jbi;
     _m_oIs.clear();
     _m_prevJoIs.clear();
     _m_prevJaIs.clear();
@@ -173,18 +177,9 @@ void AgentBG::ResetEpisode()
 
 int AgentBG::GetMaximizingBGIndex(const JointBeliefInterface &jb) const
 {
-    double v=-DBL_MAX,q;
-    int bI,betaMaxI=INT_MAX;
-
-    for(Index a=0;a!=GetPU()->GetNrJointActions();++a)
-    {
-        q=_m_QBG->GetQ(jb,a,bI);
-        if(q>v)
-        {
-            v=q;
-            betaMaxI=bI;
-        }
-    }
+    Index ja;
+    double v;
+    int betaMaxI=_m_avIndex.GetMaximizingVector(jb,ja,v).GetBetaI();
 
 #if DEBUG_AgentBG
     cout << "GetMaximizingBGIndex " << GetIndex() << ": betaMaxI " << betaMaxI 
@@ -195,20 +190,8 @@ int AgentBG::GetMaximizingBGIndex(const JointBeliefInterface &jb) const
 
 Index AgentBG::GetMaximizingActionIndex(const JointBeliefInterface &jb) const
 {
-    double v=-DBL_MAX,q;
-    Index ja=INT_MAX;
-    int bI;
-
-    for(Index a=0;a!=GetPU()->GetNrJointActions();++a)
-    {
-        q=_m_QBG->GetQ(jb,a,bI);
-        
-        if(q>v)
-        {
-            v=q;
-            ja=a;
-        }
-    }
-
+    Index ja;
+    double v;
+    _m_avIndex.GetMaximizingVector(jb,ja,v);
     return(ja);
 }
@@ -32,16 +32,21 @@
 /* the include directives */
 #include <iostream>
 #include "Globals.h"
-#include "JointBeliefSparse.h"
 #include "AgentDelayedSharedObservations.h"
 #include "QAV.h"
+#include "AlphaVectorIndex.h"
 
 class PerseusBGPlanner;
 class JointBeliefInterface;
+class JointBeliefTracker;
 class JointPolicyPureVector;
 class BayesianGameIdenticalPayoff;
 
-/**AgentBG represents an agent which uses a BG-based policy. */
+/**AgentBG represents an agent which uses a BG-based policy.
+ *
+ * The joint belief of the previous stage is the same for all agents,
+ * so they can share a JointBeliefTracker. The BG policy is looked up
+ * in an AlphaVectorIndex. */
 class AgentBG : public AgentDelayedSharedObservations
 {
 private:    
@@ -50,7 +55,11 @@ private:
 
     size_t _m_t;
 
-    JointBeliefSparse _m_prevJB;
+    JointBeliefTracker *_m_jbTracker;
+    /// Whether _m_jbTracker was allocated by (and belongs to) this agent.
+    bool _m_ownJBTracker;
+
+    AlphaVectorIndex _m_avIndex;
     
     BayesianGameIdenticalPayoff *_m_bgip;
 
@@ -66,9 +75,13 @@ private:
 public:
 
     // Constructor, destructor and copy assignment.
-    /// (default) Constructor
+    /** \brief (default) Constructor
+     *
+     * If \a jbTracker is 0 the agent tracks the joint belief by
+     * itself, otherwise it uses (but does not own) \a jbTracker. */
     AgentBG(const PlanningUnitDecPOMDPDiscrete &pu, Index id,
-            QAV<PerseusBGPlanner> *QBG);
+            QAV<PerseusBGPlanner> *QBG,
+            JointBeliefTracker *jbTracker=0);
 
     /// Copy constructor.
     AgentBG(const AgentBG& a);
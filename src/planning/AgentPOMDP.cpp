@@ -29,56 +29,59 @@
 #include <float.h>
 #include "PlanningUnitDecPOMDPDiscrete.h"
 #include "JointBeliefInterface.h"
+#include "JointBeliefTracker.h"
 
 using namespace std;
 
 #define DEBUG_AgentPOMDP 0
 
 AgentPOMDP::AgentPOMDP(const PlanningUnitDecPOMDPDiscrete &pu, Index id,
-                       QAV<PerseusPOMDPPlanner> *QPOMDP) :
+                       QAV<PerseusPOMDPPlanner> *QPOMDP,
+                       JointBeliefTracker *jbTracker) :
     AgentSharedObservations(pu,id),
     _m_QPOMDP(QPOMDP),
-    _m_t(0)
+    _m_t(0),
+    _m_jbTracker(jbTracker),
+    _m_ownJBTracker(jbTracker==0),
+    _m_avIndex(QPOMDP->GetPlanner()->GetQFunctions()),
+    _m_prevJaI(INT_MAX)
 {
-    _m_jb=GetPU()->GetNewJointBeliefInterface();
+    if(_m_ownJBTracker)
+        _m_jbTracker=new JointBeliefTracker(pu);
 }
 
 AgentPOMDP::AgentPOMDP(const AgentPOMDP& a) :
     AgentSharedObservations(a),
     _m_QPOMDP(a._m_QPOMDP),
     _m_t(a._m_t),
+    _m_jbTracker(a._m_jbTracker), // share the tracker, unless a owns it
+    _m_ownJBTracker(a._m_ownJBTracker),
+    _m_avIndex(a._m_avIndex),
     _m_prevJaI(a._m_prevJaI)
 {
-    _m_jb=GetPU()->GetNewJointBeliefInterface();
-    *_m_jb=*a._m_jb;
+    if(_m_ownJBTracker)
+        _m_jbTracker=new JointBeliefTracker(*a._m_jbTracker);
 }
 
 //Destructor
 AgentPOMDP::~AgentPOMDP()
 {
-    delete _m_jb;
+    if(_m_ownJBTracker)
+        delete _m_jbTracker;
 }
 
 Index AgentPOMDP::Act(Index joI)
 {
-    if(_m_t>0)
-        _m_jb->Update(*GetPU()->GetReferred(),_m_prevJaI,joI);
+    const JointBeliefInterface &jb=
+        _m_jbTracker->GetJointBelief(_m_t,_m_prevJaI,joI);
 
-    Index jaInew=INT_MAX;
-    double q,v=-DBL_MAX;
-    for(size_t a=0;a!=GetPU()->GetNrJointActions();++a)
-    {
-        q=_m_QPOMDP->GetQ(*_m_jb,a);
-        if(q>v)
-        {
-            v=q;
-            jaInew=a;
-        }
-    }
+    Index jaInew;
+    double v;
+    _m_avIndex.GetMaximizingVector(jb,jaInew,v);
 
 #if DEBUG_AgentPOMDP
     cout << GetIndex() << ": ";
-    _m_jb.Print();
+    jb.Print();
     cout << " v " << v << endl;
 #endif
 
@@ -93,6 +96,5 @@ Index AgentPOMDP::Act(Index joI)
 void AgentPOMDP::ResetEpisode()
 {
     _m_t=0;
-    *_m_jb=*GetPU()->GetNewJointBeliefFromISD(); // isa JointBeliefInterface*
     _m_prevJaI=INT_MAX;
 }
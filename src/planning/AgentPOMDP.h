@@ -37,10 +37,15 @@
 #include "QFunctionJAOHInterface.h"
 #include "QAV.h"
 #include "PerseusPOMDPPlanner.h"
+#include "AlphaVectorIndex.h"
 
-class JointBeliefInterface;
+class JointBeliefTracker;
 
-/**AgentPOMDP represents an agent which POMDP-based policy. */
+/**AgentPOMDP represents an agent which POMDP-based policy.
+ *
+ * As all agents share their observations, they can also share a
+ * JointBeliefTracker, such that the joint belief is updated only once
+ * per stage. The joint action is looked up in an AlphaVectorIndex. */
 class AgentPOMDP : public AgentSharedObservations
 {
 private:    
@@ -49,16 +54,24 @@ private:
 
     size_t _m_t;
 
-    JointBeliefInterface *_m_jb;
+    JointBeliefTracker *_m_jbTracker;
+    /// Whether _m_jbTracker was allocated by (and belongs to) this agent.
+    bool _m_ownJBTracker;
+
+    AlphaVectorIndex _m_avIndex;
     
     Index _m_prevJaI;
 
 public:
 
     // Constructor, destructor and copy assignment.
-    /// (default) Constructor
+    /** \brief (default) Constructor
+     *
+     * If \a jbTracker is 0 the agent tracks the joint belief by
+     * itself, otherwise it uses (but does not own) \a jbTracker. */
     AgentPOMDP(const PlanningUnitDecPOMDPDiscrete &pu, Index id,
-               QAV<PerseusPOMDPPlanner> *QPOMDP);
+               QAV<PerseusPOMDPPlanner> *QPOMDP,
+               JointBeliefTracker *jbTracker=0);
 
     /// Copy constructor.
     AgentPOMDP(const AgentPOMDP& a);
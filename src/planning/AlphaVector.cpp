@@ -70,7 +70,7 @@ string AlphaVector::SoftPrint() const
     stringstream ss;
     ss << "a " << _m_action << " bI " << _m_betaI
        << " : values";
-    vector<double>::const_iterator it=_m_values.begin();
+    vector<Scalar>::const_iterator it=_m_values.begin();
     while(it!=_m_values.end())
     {
         ss << " " << *it;
@@ -80,12 +80,22 @@ string AlphaVector::SoftPrint() const
 }
 
 void AlphaVector::SetValues(const vector<double> &vs)
+{
+    if(vs.size()!=_m_values.size())
+        throw(E("AlphaVector::SetValues vector sizes do not match"));
+    else
+        _m_values.assign(vs.begin(),vs.end());
+}
+
+#if MADP_FLOAT_PRECISION
+void AlphaVector::SetValues(const vector<Scalar> &vs)
 {
     if(vs.size()!=_m_values.size())
         throw(E("AlphaVector::SetValues vector sizes do not match"));
     else
         _m_values=vs;
 }
+#endif
     
 bool AlphaVector::Equal(const AlphaVector &alpha) const
 {
@@ -98,9 +108,7 @@ bool AlphaVector::Equal(const AlphaVector &alpha) const
     if(this->GetBetaI()!=alpha.GetBetaI())
         return(false);
 
-    vector<double> values=alpha.GetValues();
-
-    if(_m_values!=values)
+    if(_m_values!=alpha.GetValues())
         return(false);
 
     // else
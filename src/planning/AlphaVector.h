@@ -42,7 +42,7 @@ private:
     
     Index _m_action;
     int _m_betaI;
-    std::vector<double> _m_values;
+    std::vector<Scalar> _m_values;
     
 protected:
     
@@ -69,12 +69,15 @@ public:
     //data manipulation (set) functions:
     void SetAction(Index a){ _m_action=a; }
     void SetValues(const std::vector<double> &vs);
+#if MADP_FLOAT_PRECISION
+    void SetValues(const std::vector<Scalar> &vs);
+#endif
     void SetValue(double v,Index i){ _m_values.at(i)=v; }
     void SetBetaI(int betaI){ _m_betaI=betaI; }
     
     //get (data) functions:
     Index GetAction() const { return(_m_action); }
-    const std::vector<double> &GetValues() const { return(_m_values); }
+    const std::vector<Scalar> &GetValues() const { return(_m_values); }
     double GetValue(Index i) const { return(_m_values.at(i)); }
 
     unsigned int GetNrValues() const { return(_m_values.size()); }
@@ -27,6 +27,7 @@
 
 #include "AlphaVectorBG.h"
 #include <float.h>
+#include <algorithm>
 #include <sys/times.h>
 #include "JointPolicyPureVector.h"
 #include "BayesianGameIdenticalPayoffSolver.h"
@@ -42,6 +43,10 @@ using namespace std;
 #define DEBUG_AlphaVectorBG_BeliefBackup 0
 #define DEBUG_AlphaVectorBG_CheckBGIP_SolverExhaustive 0
 
+/// The nr. of BG policies that BeliefBackupExhaustiveOnlyKeepMax()
+/// enumerates in a single (parallel) task.
+#define AlphaVectorBG_BetaChunkSize 1024
+
 //Default constructor
 AlphaVectorBG::AlphaVectorBG(const PlanningUnitDecPOMDPDiscrete& pu) :
     AlphaVectorPlanning(pu)
@@ -61,7 +66,7 @@ AlphaVectorBG::~AlphaVectorBG()
 AlphaVector
 AlphaVectorBG::BeliefBackup(const JointBeliefInterface &b,
                             Index a,
-                            const GaoVectorSet &G,
+                            const BackProjection &G,
                             const ValueFunctionPOMDPDiscrete &V,
                             BGBackupType type) const
 {
@@ -134,7 +139,7 @@ AlphaVectorBG::GetMask(const ValueFunctionPOMDPDiscrete &V) const
 AlphaVector
 AlphaVectorBG::BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
                                     Index a,
-                                    const GaoVectorSet &G,
+                                    const BackProjection &G,
                                     const ValueFunctionPOMDPDiscrete &V,
                                     BGBackupType type) const
 {
@@ -144,7 +149,6 @@ AlphaVectorBG::BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
         nrO=GetPU()->GetNrJointObservations(),
         nrS=GetPU()->GetNrStates();
     double gamma=GetPU()->GetDiscount();
-    double value;
 
     // the mask selects which vectors to consider:
     // mask[jaI][vI] is true <-> vector vI specifies action jaI
@@ -152,19 +156,22 @@ AlphaVectorBG::BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
 
     boost::numeric::ublas::matrix<int> bestG_oa1(nrO,nrA);
 
+    vector<int> bestG_a1;
+    vector<double> values;
     for(unsigned int o=0;o!=nrO;o++)
+    {
+        G.GetMaximizingVectorIndices(b,a,o,mask,bestG_a1,values);
         for(unsigned int a1=0;a1!=nrA;++a1)
         {
-            bestG_oa1(o,a1)=
-                BeliefValue::GetMaximizingVectorIndexAndValue(b,*G[a][o],
-                                                              mask[a1],value);
+            bestG_oa1(o,a1)=bestG_a1[a1];
 
             if(bestG_oa1(o,a1)==-1)
                 abort();
 
-            _m_bgip->SetUtility(o,a1,value);
+            _m_bgip->SetUtility(o,a1,values[a1]);
             _m_bgip->SetProbability(o,1.0/nrO);
         }
+    }
 
     BayesianGameIdenticalPayoffSolver<JointPolicyPureVector> *BGIP_Solver;
     switch(type)
@@ -187,16 +194,17 @@ AlphaVectorBG::BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
 
     delete BGIP_Solver;
 
-    vector<double> best(nrS);
+    vector<double> best(nrS,0.0);
     Index a1;
-    for(unsigned int s=0;s!=nrS;++s)
+    const Scalar *g;
+    for(unsigned int o=0;o!=nrO;o++)
     {
-        best[s]=0;
-        for(unsigned int o=0;o!=nrO;o++)
+        a1=jpol.GetJointActionIndex(o);
+        if(bestG_oa1(o,a1)!=-1)
         {
-            a1=jpol.GetJointActionIndex(o);
-            if(bestG_oa1(o,a1)!=-1)
-                best[s]+=(*G[a][o])(bestG_oa1(o,a1),s);
+            g=G.GetVector(a,o,bestG_oa1(o,a1));
+            for(unsigned int s=0;s!=nrS;++s)
+                best[s]+=g[s];
         }
     }
 
@@ -218,7 +226,7 @@ AlphaVectorBG::BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
 AlphaVector
 AlphaVectorBG::BeliefBackupExhaustiveOnlyKeepMax(const JointBeliefInterface &b,
                                                  Index a,
-                                                 const GaoVectorSet &G,
+                                                 const BackProjection &G,
                                                  const 
                                                  ValueFunctionPOMDPDiscrete &V)
     const
@@ -246,63 +254,150 @@ AlphaVectorBG::BeliefBackupExhaustiveOnlyKeepMax(const JointBeliefInterface &b,
     //      g*_baoa' =  arg max_g^va'_ao \sum_s g^va'_ao(s) * b(s)
     //
     // I.e., we select the maximizing vector for each possible a'.
-    // we store this in bestG_oa1[o][a'].
+    // we store its index in bestG_oa1(o,a') and its value for b in
+    // bestV_oa1[o*nrA+a'] (0 if no vector specifies a').
     boost::numeric::ublas::matrix<int> bestG_oa1(nrO,nrA);
+    vector<double> bestV_oa1(nrO*nrA,0.0);
 
     // (14)
+    vector<int> bestG_a1;
+    vector<double> values;
     for(unsigned int o=0;o!=nrO;o++)
+    {
+        G.GetMaximizingVectorIndices(b,a,o,mask,bestG_a1,values);
         for(unsigned int a1=0;a1!=nrA;++a1)
-            bestG_oa1(o,a1)=BeliefValue::GetMaximizingVectorIndex(b,*G[a][o],
-                                                                  mask[a1]);
+        {
+            bestG_oa1(o,a1)=bestG_a1[a1];
+            if(bestG_a1[a1]!=-1)
+                bestV_oa1[o*nrA+a1]=values[a1];
+        }
+    }
 
-    // now we create a jpol for the induced Bayesian game
-    // (i.e. \beta mentioned above, is the policy for a Bayesian game)
-    // and use that to combine the bestG_oa1 to g_a-vectors:
-    //  g_ba\beta = \sum_o bestG_oa1[o][ \beta(o) ]
-    JointPolicyPureVector jpol(*_m_bgip);
-    Index a1;
-    bool round=false;
+    // now we find the policy \beta for the induced Bayesian game
+    // that maximizes
+    //  b . g_ba\beta = \sum_o bestV_oa1[o][ \beta(o) ]
+    // which only involves scalars, so we do not have to construct
+    // g_ba\beta itself for every \beta.
+    //
+    // The \beta are enumerated in chunks, which are processed in
+    // parallel. Within a chunk, after incrementing \beta only the
+    // joint observations for which an individual action changed
+    // are updated.
+    size_t nrAgents=GetPU()->GetNrAgents();
+    vector<Index> stepSize(nrAgents,1);
+    for(Index agentI=nrAgents-1;agentI>0;agentI--)
+        stepSize[agentI-1]=stepSize[agentI]*
+            GetPU()->GetNrActions(agentI);
+    // oOfType[agentI][t]: the joint observations in which agentI has type t
+    vector<vector<vector<Index> > > oOfType(nrAgents);
+    for(Index agentI=0;agentI!=nrAgents;agentI++)
+        oOfType[agentI].resize(_m_bgip->GetNrTypes(agentI));
+    for(unsigned int o=0;o!=nrO;o++)
+    {
+        const vector<Index> &types=_m_bgip->JointToIndividualTypeIndices(o);
+        for(Index agentI=0;agentI!=nrAgents;agentI++)
+            oOfType[agentI][types[agentI]].push_back(o);
+    }
 
-    vector<double> current(nrS),best(nrS);
-    double v,bestValue=-DBL_MAX;
-    int betaMaxI=-1;
-    int k=0;
-    // (16)
-    while (!round) // i.e. forall \beta
+    LIndex nrBetas=_m_bgip->GetNrJointPolicies();
+    int nrChunks=static_cast<int>((nrBetas+AlphaVectorBG_BetaChunkSize-1)/
+                                  AlphaVectorBG_BetaChunkSize);
+    vector<double> chunkBestValue(nrChunks,-DBL_MAX);
+    vector<LIndex> chunkBetaMaxI(nrChunks,0);
+
+#pragma omp parallel for schedule(dynamic)
+    for(int chunk=0;chunk<nrChunks;chunk++)
     {
-        // first create the current g_baBeta-vector:
-        //  current g_ba\beta = \sum_o bestG_oa1[o][ \beta(o) ]
-        for(unsigned int s=0;s!=nrS;++s)
+        LIndex first=static_cast<LIndex>(chunk)*AlphaVectorBG_BetaChunkSize,
+            last=min(first+AlphaVectorBG_BetaChunkSize,nrBetas);
+
+        JointPolicyPureVector jpol(*_m_bgip);
+        jpol.SetIndex(first);
+
+        // the individual actions of jpol, and the resulting joint
+        // action for each joint observation
+        vector<vector<Index> > actions(nrAgents);
+        vector<Index> ja(nrO,0);
+        for(Index agentI=0;agentI!=nrAgents;agentI++)
+        {
+            actions[agentI].resize(oOfType[agentI].size());
+            for(Index t=0;t!=actions[agentI].size();t++)
+            {
+                actions[agentI][t]=jpol.GetActionIndex(agentI,t);
+                for(vector<Index>::const_iterator it=
+                        oOfType[agentI][t].begin();
+                    it!=oOfType[agentI][t].end();++it)
+                    ja[*it]+=actions[agentI][t]*stepSize[agentI];
+            }
+        }
+
+        double v,bestValue=-DBL_MAX;
+        LIndex betaMaxI=first;
+        // (16)
+        for(LIndex k=first;k!=last;k++)
         {
-            current[s]=0;
+            if(k!=first)
+            {
+                ++jpol;
+                for(Index agentI=0;agentI!=nrAgents;agentI++)
+                    for(Index t=0;t!=actions[agentI].size();t++)
+                    {
+                        Index aI=jpol.GetActionIndex(agentI,t);
+                        if(aI==actions[agentI][t])
+                            continue;
+                        for(vector<Index>::const_iterator it=
+                                oOfType[agentI][t].begin();
+                            it!=oOfType[agentI][t].end();++it)
+                            ja[*it]=ja[*it]+aI*stepSize[agentI]-
+                                actions[agentI][t]*stepSize[agentI];
+                        actions[agentI][t]=aI;
+                    }
+            }
+
+            // check if it is better...
+            v=0;
             for(unsigned int o=0;o!=nrO;o++)
+                v+=bestV_oa1[o*nrA+ja[o]];
+            if(v>bestValue)
             {
-                a1=jpol.GetJointActionIndex(o);
-                /* following code implements:
-                 * VectorSet V=*G[a][o];
-                 * int i=bestG_oa1(o,a1);
-                 * current[s]+=V(i,s); // +=V[i][s]; */
-                 if(bestG_oa1(o,a1)!=-1)
-                     current[s]+=(*G[a][o])(bestG_oa1(o,a1),s);
+                bestValue=v;
+                betaMaxI=k;
             }
         }
-        // check if it is better...
-        v=b.InnerProduct(current);
-        if(v>bestValue)
+        chunkBestValue[chunk]=bestValue;
+        chunkBetaMaxI[chunk]=betaMaxI;
+    }
+
+    // the first chunk with the highest value has the lowest \beta index
+    int bestChunk=0;
+    for(int chunk=1;chunk<nrChunks;chunk++)
+        if(chunkBestValue[chunk]>chunkBestValue[bestChunk])
+            bestChunk=chunk;
+    LIndex betaMaxI=chunkBetaMaxI[bestChunk];
+
+    // only construct g_ba\beta for the maximizing \beta:
+    //  g_ba\beta = \sum_o bestG_oa1[o][ \beta(o) ]
+    JointPolicyPureVector jpol(*_m_bgip);
+    jpol.SetIndex(betaMaxI);
+    vector<double> best(nrS,0.0);
+    Index a1;
+    const Scalar *g;
+    for(unsigned int o=0;o!=nrO;o++)
+    {
+        a1=jpol.GetJointActionIndex(o);
+        if(bestG_oa1(o,a1)!=-1)
         {
-            bestValue=v;
-            best=current;
-            betaMaxI=k;
+            g=G.GetVector(a,o,bestG_oa1(o,a1));
+            for(unsigned int s=0;s!=nrS;++s)
+                best[s]+=g[s];
         }
-        round = ++(jpol);
-        k++;
     }
 
     double x;
     // create the vector for b
     AlphaVector newVector(nrS);
     newVector.SetAction(a);
-    newVector.SetBetaI(betaMaxI);
+    newVector.SetBetaI(static_cast<int>(betaMaxI));
     for(unsigned int s=0;s!=nrS;s++)
     {
         // (19)
@@ -316,7 +411,7 @@ AlphaVectorBG::BeliefBackupExhaustiveOnlyKeepMax(const JointBeliefInterface &b,
 AlphaVector
 AlphaVectorBG::BeliefBackupExhaustiveStoreAll(const JointBeliefInterface &b,
                                               Index a,
-                                              const GaoVectorSet &G,
+                                              const BackProjection &G,
                                               const 
                                               ValueFunctionPOMDPDiscrete &V)
     const
@@ -344,19 +439,25 @@ AlphaVectorBG::BeliefBackupExhaustiveStoreAll(const JointBeliefInterface &b,
     //      g*_baoa' =  arg max_g^va'_ao \sum_s g^va'_ao(s) * b(s)
     //
     // I.e., we select the maximizing vector for each possible a'.
-    // we store this in bestG_oa1[o][a'].
-    boost::numeric::ublas::matrix<int> bestG_oa1(nrO,nrA);
+    // we store this in bestg_oa1[o][a'] (0 if no vector specifies a').
+    vector<vector<const Scalar*> > bestg_oa1(nrO,
+                                             vector<const Scalar*>(nrA,0));
 
     // (14)
+    vector<int> bestG_a1;
+    vector<double> values;
     for(unsigned int o=0;o!=nrO;o++)
+    {
+        G.GetMaximizingVectorIndices(b,a,o,mask,bestG_a1,values);
         for(unsigned int a1=0;a1!=nrA;++a1)
-            bestG_oa1(o,a1)=BeliefValue::GetMaximizingVectorIndex(b,*G[a][o],
-                                                                  mask[a1]);
+            if(bestG_a1[a1]!=-1)
+                bestg_oa1[o][a1]=G.GetVector(a,o,bestG_a1[a1]);
+    }
 
     // now we create a jpol for the induced Bayesian game
     // (i.e. \beta mentioned above, is the policy for a Bayesian game)
-    // and use that to combine the bestG_oa1 to g_a-vectors:
-    //  g_ba\beta = \sum_o bestG_oa1[o][ \beta(o) ]
+    // and use that to combine the bestg_oa1 to g_a-vectors:
+    //  g_ba\beta = \sum_o bestg_oa1[o][ \beta(o) ]
     JointPolicyPureVector jpol(*_m_bgip);
     Index a1;
     bool round=false;
@@ -370,16 +471,13 @@ AlphaVectorBG::BeliefBackupExhaustiveStoreAll(const JointBeliefInterface &b,
     {
         k++;
         for(unsigned int o=0;o!=nrO;o++)
-            for(unsigned int s=0;s!=nrS;++s)
-            {
-                a1=jpol.GetJointActionIndex(o);
-                /* following code implements:
-                 * VectorSet V=*G[a][o];
-                 * int i=bestG_oa1(o,a1);
-                 * g_baBeta(k,s)+=V(i,s); // +=V[i][s]; */
-                 if(bestG_oa1(o,a1)!=-1)
-                     g_baBeta(k,s)+=(*G[a][o])(bestG_oa1(o,a1),s);
-            }
+        {
+            a1=jpol.GetJointActionIndex(o);
+            const Scalar *g=bestg_oa1[o][a1];
+            if(g!=0)
+                for(unsigned int s=0;s!=nrS;++s)
+                    g_baBeta(k,s)+=g[s];
+        }
         round = ++(jpol);
     }
 
@@ -34,6 +34,7 @@
 #include "Globals.h"
 
 #include "AlphaVectorPlanning.h"
+#include "BackProjection.h"
 #include "BGBackupType.h"
 
 class BayesianGameIdenticalPayoff;
@@ -54,20 +55,20 @@ private:
 
     AlphaVector BeliefBackupBGIP_Solver(const JointBeliefInterface &b,
                                      Index a,
-                                     const GaoVectorSet &G,
+                                     const BackProjection &G,
                                      const ValueFunctionPOMDPDiscrete &V,
                                      BGBackupType type) const;
 
     AlphaVector
     BeliefBackupExhaustiveOnlyKeepMax(const JointBeliefInterface &b,
                                       Index a,
-                                      const GaoVectorSet &G,
+                                      const BackProjection &G,
                                       const ValueFunctionPOMDPDiscrete &V) const;
 
     AlphaVector
     BeliefBackupExhaustiveStoreAll(const JointBeliefInterface &b,
                                    Index a,
-                                   const GaoVectorSet &G,
+                                   const BackProjection &G,
                                    const ValueFunctionPOMDPDiscrete &V) const;
 
 protected:
@@ -82,7 +83,7 @@ public:
 
     AlphaVector BeliefBackup(const JointBeliefInterface &b,
                              Index a,
-                             const GaoVectorSet &G,
+                             const BackProjection &G,
                              const ValueFunctionPOMDPDiscrete &V,
                              BGBackupType type=BGIP_SOLVER_EXHAUSTIVE) const;
 
@@ -0,0 +1,99 @@
+/**\file AlphaVectorIndex.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "AlphaVectorIndex.h"
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include "JointBeliefInterface.h"
+
+using namespace std;
+
+AlphaVectorIndex::AlphaVectorIndex(const QFunctionsDiscrete &Q)
+{
+    for(Index a=0;a!=Q.size();++a)
+        for(Index k=0;k!=Q[a].size();++k)
+        {
+            const vector<Scalar> &values=Q[a][k].GetValues();
+            double maxVal=-DBL_MAX,maxAbs=0;
+            for(Index s=0;s!=values.size();++s)
+            {
+                maxVal=max<double>(maxVal,values[s]);
+                maxAbs=max<double>(maxAbs,fabs(values[s]));
+            }
+
+            Entry e;
+            // allow for beliefs that sum to slightly more than 1
+            e.bound=maxVal+PROB_PRECISION*maxAbs;
+            e.jaI=a;
+            e.vI=k;
+            e.alpha=&Q[a][k];
+            _m_entries.push_back(e);
+        }
+
+    sort(_m_entries.begin(),_m_entries.end(),CompareEntries);
+}
+
+bool AlphaVectorIndex::CompareEntries(const Entry &a, const Entry &b)
+{
+    if(a.bound!=b.bound)
+        return(a.bound>b.bound);
+    if(a.jaI!=b.jaI)
+        return(a.jaI<b.jaI);
+    return(a.vI<b.vI);
+}
+
+const AlphaVector&
+AlphaVectorIndex::GetMaximizingVector(const JointBeliefInterface &b,
+                                      Index &jaI, double &value) const
+{
+    if(_m_entries.empty())
+        throw(E("AlphaVectorIndex::GetMaximizingVector: no vectors"));
+
+    const Entry *best=0;
+    double v,maxVal=-DBL_MAX;
+    for(vector<Entry>::const_iterator it=_m_entries.begin();
+        it!=_m_entries.end();++it)
+    {
+        // no remaining vector can do better (vectors with a bound equal
+        // to maxVal are still considered for tie-breaking)
+        if(it->bound<maxVal)
+            break;
+        v=b.InnerProduct(it->alpha->GetValues());
+        if(best==0 || v>maxVal ||
+           (v==maxVal && (it->jaI<best->jaI ||
+                          (it->jaI==best->jaI && it->vI<best->vI))))
+        {
+            maxVal=v;
+            best=&(*it);
+        }
+    }
+
+    jaI=best->jaI;
+    value=maxVal;
+    return(*best->alpha);
+}
@@ -0,0 +1,97 @@
+/**\file AlphaVectorIndex.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _ALPHAVECTORINDEX_H_
+#define _ALPHAVECTORINDEX_H_ 1
+
+/* the include directives */
+#include <vector>
+#include "Globals.h"
+#include "ValueFunctionPOMDPDiscrete.h"
+
+class JointBeliefInterface;
+
+/**\brief AlphaVectorIndex is an index on a set of Q functions
+ * (QFunctionsDiscrete) for finding the vector that maximizes the
+ * value of a joint belief.
+ *
+ * As a belief is a probability distribution, the largest entry of an
+ * alpha vector is an upper bound on its value. The vectors of all
+ * joint actions are sorted by this bound, such that the search can
+ * stop as soon as the bound drops below the best value found so far,
+ * which typically happens after only a few inner products.
+ *
+ * The index refers to the alpha vectors of the Q functions it was
+ * constructed from, so these should outlive it.
+ */
+class AlphaVectorIndex 
+{
+private:    
+
+    struct Entry
+    {
+        /// An upper bound on the value of any belief.
+        double bound;
+        Index jaI;
+        /// The index of the vector in the Q function of jaI.
+        Index vI;
+        const AlphaVector *alpha;
+    };
+
+    /// All vectors, sorted by decreasing bound.
+    std::vector<Entry> _m_entries;
+
+    static bool CompareEntries(const Entry &a, const Entry &b);
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructor, indexes all vectors in \a Q.
+    AlphaVectorIndex(const QFunctionsDiscrete &Q);
+
+    /**\brief Returns the vector that maximizes the value of \a b.
+     *
+     * The joint action of the vector is returned in \a jaI and its
+     * value in \a value. Ties are resolved as by a linear scan over
+     * all joint actions and vectors, i.e., in favor of the lowest
+     * joint action index and then the lowest vector index. */
+    const AlphaVector& GetMaximizingVector(const JointBeliefInterface &b,
+                                           Index &jaI,
+                                           double &value) const;
+
+    /// Returns the number of vectors in the index.
+    size_t GetNrVectors() const { return(_m_entries.size()); }
+};
+
+
+#endif /* !_ALPHAVECTORINDEX_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -49,12 +49,12 @@ AlphaVectorPOMDP::~AlphaVectorPOMDP()
  * Implements equation (3.18) of PhD thesis Matthijs.
  */
 AlphaVector AlphaVectorPOMDP::BeliefBackup(const JointBeliefInterface &b,
-                                           const GaoVectorSet &G) const
+                                           const BackProjection &G) const
 {
     int nrA=GetPU()->GetNrJointActions(),
         nrO=GetPU()->GetNrJointObservations(),
         nrS=GetPU()->GetNrStates();
-    VectorSet *VS;
+    const Scalar *g;
     // stores the index of the vector that maximizes b's value
     int maximizingVectorI;
 
@@ -71,13 +71,12 @@ AlphaVector AlphaVectorPOMDP::BeliefBackup(const JointBeliefInterface &b,
 
         for(GaoVectorSetIndex o=0;o!=nrO;o++)
         {
-            VS=G[a][o];
-            maximizingVectorI=BeliefValue::GetMaximizingVectorIndex(b,*VS);
+            maximizingVectorI=G.GetMaximizingVectorIndex(b,a,o);
+            g=G.GetVector(a,o,maximizingVectorI);
 
             // add discounted maximizing vector (3.16)
             for(int s=0;s!=nrS;s++)
-                Gab(a,s)+=GetPU()->GetDiscount()*
-                    (*VS)(maximizingVectorI,s);
+                Gab(a,s)+=GetPU()->GetDiscount()*g[s];
         }
     }
 
@@ -97,11 +96,11 @@ AlphaVector AlphaVectorPOMDP::BeliefBackup(const JointBeliefInterface &b,
 
 AlphaVector AlphaVectorPOMDP::BeliefBackup(const JointBeliefInterface &b,
                                            Index a,
-                                           const GaoVectorSet &G) const
+                                           const BackProjection &G) const
 {
     int nrO=GetPU()->GetNrJointObservations(),
         nrS=GetPU()->GetNrStates();
-    VectorSet *VS;
+    const Scalar *g;
     // stores the index of the vector that maximizes b's value
     int maximizingVectorI;
 
@@ -115,13 +114,12 @@ AlphaVector AlphaVectorPOMDP::BeliefBackup(const JointBeliefInterface &b,
     
     for(GaoVectorSetIndex o=0;o!=nrO;o++)
     {
-        VS=G[a][o];
-        maximizingVectorI=BeliefValue::GetMaximizingVectorIndex(b,*VS);
+        maximizingVectorI=G.GetMaximizingVectorIndex(b,a,o);
+        g=G.GetVector(a,o,maximizingVectorI);
         
         // add discounted maximizing vector (3.16)
         for(int s=0;s!=nrS;s++)
-            Gab[s]+=GetPU()->GetDiscount()*
-                (*VS)(maximizingVectorI,s);
+            Gab[s]+=GetPU()->GetDiscount()*g[s];
     }
 
     // create the vector for b
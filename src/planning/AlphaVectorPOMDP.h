@@ -34,6 +34,7 @@
 #include "Globals.h"
 
 #include "AlphaVectorPlanning.h"
+#include "BackProjection.h"
 
 class PlanningUnitDecPOMDPDiscrete;
 class AlphaVector;
@@ -59,11 +60,11 @@ public:
     /// Computes the AlphaVector resulting from backing up JointBeliefInterface
     /// \a b with the back-projected vectors in \a G.
     AlphaVector BeliefBackup(const JointBeliefInterface &b,
-                             const GaoVectorSet &G) const;
+                             const BackProjection &G) const;
     
     AlphaVector BeliefBackup(const JointBeliefInterface &b,
                              Index a,
-                             const GaoVectorSet &G) const;
+                             const BackProjection &G) const;
 
 };
 
@@ -0,0 +1,288 @@
+/**\file AlphaVectorPruning.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "AlphaVectorPruning.h"
+#include <iostream>
+#include <algorithm>
+#include "SimplexLP.h"
+
+#define DEBUG_AlphaVectorPruning 0
+
+using namespace std;
+
+/// The number of vectors that are checked in parallel by PointwisePrune().
+static const int ALPHAVECTORPRUNING_BLOCKSIZE=256;
+
+/// Orders the rows of a VectorSet lexicographically, in decreasing order.
+struct LexicographicallyGreater
+{
+    const vector<const Scalar*> &rows;
+    size_t nrS;
+
+    LexicographicallyGreater(const vector<const Scalar*> &r, size_t n) :
+        rows(r), nrS(n) {}
+
+    bool operator()(Index i, Index j) const
+    {
+        const Scalar *u=rows[i],*w=rows[j];
+        for(Index s=0;s!=nrS;s++)
+            if(u[s]!=w[s])
+                return(u[s]>w[s]);
+        // identical vectors keep their original order
+        return(i<j);
+    }
+};
+
+AlphaVectorPruning::AlphaVectorPruning(bool useLP, double epsilon) :
+    _m_useLP(useLP),
+    _m_epsilon(epsilon)
+{
+}
+
+bool AlphaVectorPruning::Dominates(const Scalar *u, const Scalar *w,
+                                   size_t nrS)
+{
+    // The comparisons are done in branch-free chunks such that the
+    // compiler can vectorize them, only checking for an early exit
+    // after each chunk.
+    const size_t chunk=8;
+    size_t s=0;
+    for(;s+chunk<=nrS;s+=chunk)
+    {
+        int worse=0;
+        for(size_t k=0;k!=chunk;k++)
+            worse|=(w[s+k]>u[s+k]);
+        if(worse)
+            return(false);
+    }
+    for(;s!=nrS;s++)
+        if(w[s]>u[s])
+            return(false);
+    return(true);
+}
+
+vector<Index> AlphaVectorPruning::PointwisePrune(const VectorSet &V) const
+{
+    int nrInV=V.size1();
+    size_t nrS=V.size2();
+    vector<Index> kept;
+    if(nrInV==0)
+        return(kept);
+
+    vector<const Scalar*> rows(nrInV);
+    vector<Index> order(nrInV);
+    // a vector can only dominate vectors with a lower (or equal) sum
+    vector<double> sums(nrInV,0.0);
+    for(int k=0;k!=nrInV;k++)
+    {
+        rows[k]=&V(k,0);
+        order[k]=k;
+        for(Index s=0;s!=nrS;s++)
+            sums[k]+=rows[k][s];
+    }
+    sort(order.begin(),order.end(),LexicographicallyGreater(rows,nrS));
+
+    // the kept vectors are copied to contiguous storage
+    vector<Scalar> keptValues;
+    vector<double> keptSums;
+    vector<char> dominated(ALPHAVECTORPRUNING_BLOCKSIZE);
+    for(int start=0;start<nrInV;start+=ALPHAVECTORPRUNING_BLOCKSIZE)
+    {
+        int end=min(start+ALPHAVECTORPRUNING_BLOCKSIZE,nrInV);
+        int nrKept=kept.size();
+
+        // check the block against the vectors kept from earlier blocks
+#pragma omp parallel for schedule(dynamic,16)
+        for(int p=start;p<end;p++)
+        {
+            const Scalar *w=rows[order[p]];
+            double sum=sums[order[p]];
+            char dom=0;
+            for(int k=0;k<nrKept && !dom;k++)
+                if(keptSums[k]>=sum &&
+                   Dominates(&keptValues[k*nrS],w,nrS))
+                    dom=1;
+            dominated[p-start]=dom;
+        }
+
+        // and against the vectors kept from this block
+        size_t firstInBlock=kept.size();
+        for(int p=start;p!=end;p++)
+        {
+            if(dominated[p-start])
+                continue;
+            const Scalar *w=rows[order[p]];
+            double sum=sums[order[p]];
+            bool dom=false;
+            for(size_t k=firstInBlock;k!=kept.size() && !dom;k++)
+                if(keptSums[k]>=sum &&
+                   Dominates(&keptValues[k*nrS],w,nrS))
+                    dom=true;
+            if(!dom)
+            {
+                kept.push_back(order[p]);
+                keptSums.push_back(sum);
+                keptValues.insert(keptValues.end(),w,w+nrS);
+            }
+        }
+    }
+
+#if DEBUG_AlphaVectorPruning
+    cout << "AlphaVectorPruning::PointwisePrune reduced " << nrInV << " to "
+         << kept.size() << endl;
+#endif
+
+    return(kept);
+}
+
+bool AlphaVectorPruning::FindWitness(const VectorSet &V, Index w,
+                                     const vector<Index> &W,
+                                     vector<double> &b) const
+{
+    size_t nrS=V.size2(),nrW=W.size();
+
+    // max delta s.t. b.(V(w,:)-V(u,:)) >= delta for all u in W,
+    // sum_s b(s) <= 1, b >= 0, delta >= 0. If the optimum is positive
+    // it is attained with sum_s b(s) = 1.
+    SimplexLP lp(nrW+1,nrS+1);
+    lp.SetObjective(nrS,1);
+    for(Index i=0;i!=nrW;i++)
+    {
+        for(Index s=0;s!=nrS;s++)
+            lp.SetConstraint(i,s,V(W[i],s)-V(w,s));
+        lp.SetConstraint(i,nrS,1);
+    }
+    for(Index s=0;s!=nrS;s++)
+        lp.SetConstraint(nrW,s,1);
+    lp.SetBound(nrW,1);
+
+    SimplexLP::Status status=lp.Solve();
+    if(status==SimplexLP::OPTIMAL && lp.GetObjectiveValue()<=_m_epsilon)
+        return(false);
+
+    // also when the LP could not be solved the vector is kept, to be safe
+    b.assign(nrS,0.0);
+    double sum=0;
+    for(Index s=0;s!=nrS;s++)
+    {
+        b[s]=lp.GetValue(s);
+        sum+=b[s];
+    }
+    if(sum>0)
+        for(Index s=0;s!=nrS;s++)
+            b[s]/=sum;
+    else
+        b.assign(nrS,1.0/nrS);
+    return(true);
+}
+
+vector<Index> AlphaVectorPruning::LPPrune(const VectorSet &V,
+                                          const vector<Index> &candidates)
+    const
+{
+    size_t nrS=V.size2();
+    vector<Index> F(candidates),W;
+    vector<double> b;
+    if(candidates.empty())
+        return(W);
+
+    // The best vector at a belief, with ties broken lexicographically
+    // (which is the order of F), is always needed. Start with the
+    // best vectors at the corners of the belief simplex.
+    for(Index s=0;s!=nrS;s++)
+    {
+        Index best=candidates[0];
+        for(vector<Index>::const_iterator it=candidates.begin();
+            it!=candidates.end();++it)
+            if(V(*it,s)>V(best,s))
+                best=*it;
+        vector<Index>::iterator it=find(F.begin(),F.end(),best);
+        if(it!=F.end())
+        {
+            W.push_back(best);
+            F.erase(it);
+        }
+    }
+
+    while(!F.empty())
+    {
+        if(FindWitness(V,F.front(),W,b))
+        {
+            vector<Index>::iterator best=F.end();
+            double bestValue=0;
+            for(vector<Index>::iterator it=F.begin();it!=F.end();++it)
+            {
+                double value=0;
+                for(Index s=0;s!=nrS;s++)
+                    value+=b[s]*V(*it,s);
+                if(best==F.end() || value>bestValue)
+                {
+                    best=it;
+                    bestValue=value;
+                }
+            }
+            W.push_back(*best);
+            F.erase(best);
+        }
+        else
+            F.erase(F.begin());
+    }
+
+    // restore the order of the candidates
+    vector<Index> kept;
+    for(vector<Index>::const_iterator it=candidates.begin();
+        it!=candidates.end();++it)
+        if(find(W.begin(),W.end(),*it)!=W.end())
+            kept.push_back(*it);
+
+#if DEBUG_AlphaVectorPruning
+    cout << "AlphaVectorPruning::LPPrune reduced " << candidates.size()
+         << " to " << kept.size() << endl;
+#endif
+
+    return(kept);
+}
+
+vector<Index> AlphaVectorPruning::GetUndominated(const VectorSet &V) const
+{
+    vector<Index> kept=PointwisePrune(V);
+    if(_m_useLP)
+        kept=LPPrune(V,kept);
+    sort(kept.begin(),kept.end());
+    return(kept);
+}
+
+VectorSet AlphaVectorPruning::Prune(const VectorSet &V) const
+{
+    vector<Index> kept=GetUndominated(V);
+    size_t nrS=V.size2();
+    VectorSet V1(kept.size(),nrS);
+    for(Index i=0;i!=kept.size();i++)
+        for(Index s=0;s!=nrS;s++)
+            V1(i,s)=V(kept[i],s);
+    return(V1);
+}
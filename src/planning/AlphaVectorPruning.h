@@ -0,0 +1,118 @@
+/**\file AlphaVectorPruning.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _ALPHAVECTORPRUNING_H_
+#define _ALPHAVECTORPRUNING_H_ 1
+
+/* the include directives */
+#include <vector>
+#include "Globals.h"
+#include "VectorSet.h"
+
+/**\brief AlphaVectorPruning removes useless vectors from a set of
+ * alpha vectors.
+ *
+ * Pruning is done in two passes:
+ * - a pointwise dominance pass. The vectors are first sorted
+ *   lexicographically (in decreasing order), such that a vector can
+ *   only be dominated by a vector that precedes it. The vectors are
+ *   processed in blocks: each block is checked against the vectors
+ *   kept so far in parallel, after which the vectors within the block
+ *   are checked against each other.
+ * - optionally, an LP pass (see SetUseLP()) following Lark's filter
+ *   (White, 1991): a vector is only kept when there is a belief at
+ *   which it is better than all vectors kept so far by more than the
+ *   epsilon, see SetEpsilon(). The LPs are solved by SimplexLP.
+ *
+ * After the pointwise pass vectors can still be dominated by a
+ * combination of other vectors, which only the LP pass removes. Of
+ * vectors that are identical only the first is kept. */
+class AlphaVectorPruning 
+{
+private:    
+
+    bool _m_useLP;
+    double _m_epsilon;
+
+    /// Returns whether \a u is at least \a w for all nrS states.
+    static bool Dominates(const Scalar *u, const Scalar *w, size_t nrS);
+
+    /**\brief Checks whether vector \a w of \a V has a witness belief
+     * against the vectors in \a W.
+     *
+     * If so, the belief is stored in \a b and true is returned. */
+    bool FindWitness(const VectorSet &V, Index w,
+                     const std::vector<Index> &W,
+                     std::vector<double> &b) const;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// (default) Constructor
+    AlphaVectorPruning(bool useLP=false, double epsilon=REWARD_PRECISION);
+
+    /// Sets whether the LP pass is done after the pointwise pass.
+    void SetUseLP(bool useLP)
+        { _m_useLP=useLP; }
+    bool GetUseLP() const
+        { return(_m_useLP); }
+    /// Sets the minimal improvement for a witness belief in the LP pass.
+    void SetEpsilon(double epsilon)
+        { _m_epsilon=epsilon; }
+    double GetEpsilon() const
+        { return(_m_epsilon); }
+
+    /**\brief Returns the indices of the vectors in \a V that are not
+     * pointwise dominated.
+     *
+     * The indices are sorted lexicographically on their vectors, in
+     * decreasing order. */
+    std::vector<Index> PointwisePrune(const VectorSet &V) const;
+
+    /**\brief Returns the subset of \a candidates that is needed to
+     * represent max_k V(k,:).
+     *
+     * \a candidates should be sorted as returned by PointwisePrune(),
+     * the returned indices are sorted in the same order. */
+    std::vector<Index> LPPrune(const VectorSet &V,
+                               const std::vector<Index> &candidates) const;
+
+    /// Returns the (increasing) indices of the vectors of \a V to keep.
+    std::vector<Index> GetUndominated(const VectorSet &V) const;
+
+    /// Returns \a V without its dominated vectors.
+    VectorSet Prune(const VectorSet &V) const;
+};
+
+
+#endif /* !_ALPHAVECTORPRUNING_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
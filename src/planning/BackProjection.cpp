@@ -0,0 +1,159 @@
+/**\file BackProjection.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include "BackProjection.h"
+#include <float.h>
+#include "BeliefValue.h"
+#include "JointBelief.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+
+using namespace std;
+
+BackProjection::BackProjection(const AlphaVectorPlanning &avp,
+                               const ValueFunctionPOMDPDiscrete &V,
+                               bool lazy) :
+    _m_avp(&avp),
+    _m_lazy(lazy),
+    _m_nrO(avp.GetPU()->GetNrJointObservations()),
+    _m_nrS(avp.GetPU()->GetNrStates()),
+    _m_nrInV(V.size()),
+    _m_nrComputed(0)
+{
+    if(!_m_lazy)
+    {
+        GaoVectorSet G=_m_avp->BackProject(V);
+        _m_G.resize(boost::extents[G.shape()[0]][G.shape()[1]]);
+        _m_G=G;
+        _m_nrComputed=_m_G.num_elements()*_m_nrInV;
+        return;
+    }
+
+    if(_m_nrInV==0)
+        throw(E("BackProjection attempting to backproject empty value function"));
+
+    _m_V.resize(_m_nrInV,_m_nrS);
+    for(Index k=0;k!=_m_nrInV;k++)
+        for(Index s=0;s!=_m_nrS;s++)
+            _m_V(k,s)=V[k].GetValue(s);
+    _m_duplicates=AlphaVectorPlanning::GetDuplicateIndices(_m_V);
+    _m_memo.resize(avp.GetPU()->GetNrJointActions()*_m_nrO*_m_nrInV);
+}
+
+BackProjection::~BackProjection()
+{
+    // release the memory of the back-projected vectors
+    for(size_t a=0;a!=_m_G.shape()[0];a++)
+        for(size_t o=0;o!=_m_G.shape()[1];o++)
+            delete(_m_G[a][o]);
+}
+
+void BackProjection::Project(const JointBeliefInterface &b,
+                             Index a, Index o,
+                             JointBelief &bao) const
+{
+    vector<double> x;
+    _m_avp->ProjectBelief(b,a,o,x);
+    bao.Set(x);
+}
+
+int BackProjection::GetMaximizingVectorIndex(const JointBeliefInterface &b,
+                                             Index a, Index o) const
+{
+    if(!_m_lazy)
+        return(BeliefValue::GetMaximizingVectorIndex(b,*_m_G[a][o]));
+
+    JointBelief bao(_m_nrS);
+    Project(b,a,o,bao);
+    return(BeliefValue::GetMaximizingVectorIndex(bao,_m_V));
+}
+
+void BackProjection::
+GetMaximizingVectorIndices(const JointBeliefInterface &b,
+                           Index a, Index o,
+                           const vector<vector<bool> > &masks,
+                           vector<int> &indices,
+                           vector<double> &values) const
+{
+    size_t nrMasks=masks.size();
+    indices.assign(nrMasks,-1);
+    values.assign(nrMasks,-DBL_MAX);
+
+    // compute the value of b for every vector only once for all
+    // masks (projecting b first when lazy)
+    vector<double> Vb;
+    if(!_m_lazy)
+        Vb=b.InnerProduct(*_m_G[a][o]);
+    else
+    {
+        JointBelief bao(_m_nrS);
+        Project(b,a,o,bao);
+        Vb=bao.InnerProduct(_m_V);
+    }
+
+    for(Index i=0;i!=nrMasks;i++)
+    {
+        const vector<bool> &mask=masks[i];
+        if(mask.size()!=_m_nrInV)
+            throw(E("BackProjection::GetMaximizingVectorIndices: mask has incorrect size"));
+
+        bool maskValid=false;
+        for(Index k=0;k!=_m_nrInV;k++)
+        {
+            if(!mask[k])
+                continue;
+            maskValid=true;
+            if(Vb[k]>values[i])
+            {
+                values[i]=Vb[k];
+                indices[i]=k;
+            }
+        }
+
+        if(maskValid && indices[i]==-1)
+            throw(E("BackProjection::GetMaximizingVectorIndices: no maximizing vector found"));
+    }
+}
+
+const Scalar* BackProjection::GetVector(Index a, Index o, Index k) const
+{
+    if(!_m_lazy)
+        return(&(*_m_G[a][o])(k,0));
+
+    // identical vectors share their back-projection
+    if(_m_duplicates[k]!=-1)
+        k=_m_duplicates[k];
+
+    vector<Scalar> &g=_m_memo[(a*_m_nrO+o)*_m_nrInV+k];
+    if(g.empty())
+    {
+        g.resize(_m_nrS);
+        _m_avp->BackProjectVector(_m_V,k,a,o,&g[0]);
+        _m_nrComputed++;
+    }
+    return(&g[0]);
+}
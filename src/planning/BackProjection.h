@@ -0,0 +1,120 @@
+/**\file BackProjection.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _BACKPROJECTION_H_
+#define _BACKPROJECTION_H_ 1
+
+/* the include directives */
+#include <vector>
+#include "Globals.h"
+#include "AlphaVectorPlanning.h"
+
+class JointBelief;
+class JointBeliefInterface;
+
+/**\brief BackProjection provides the back-projected vectors g_ao^k of
+ * a value function to the belief backups of point-based planners.
+ *
+ * By default all g_ao^k are computed up front by
+ * AlphaVectorPlanning::BackProject(). In lazy mode nothing is
+ * computed up front: the maximizing vector for a belief b is found
+ * by projecting b forward (AlphaVectorPlanning::ProjectBelief()) and
+ * maximizing over the original value function, as b.g_ao^k equals
+ * b_ao.alpha^k. Only the g_ao^k that are actually requested via
+ * GetVector() are computed, and memoized for the rest of the backup
+ * stage. This pays off when the value function contains many more
+ * vectors than there are beliefs backed up in a stage.
+ *
+ * The memoization is not thread-safe.
+ */
+class BackProjection 
+{
+private:    
+    const AlphaVectorPlanning *_m_avp;
+    bool _m_lazy;
+    size_t _m_nrO;
+    size_t _m_nrS;
+    size_t _m_nrInV;
+
+    /// All back-projected vectors, if not _m_lazy.
+    GaoVectorSet _m_G;
+
+    /// The vectors that are back-projected, if _m_lazy.
+    VectorSet _m_V;
+    /// The index of an identical earlier vector in _m_V, or -1.
+    std::vector<int> _m_duplicates;
+    /// The g_ao^k computed so far, at (a*nrO+o)*nrInV+k.
+    mutable std::vector<std::vector<Scalar> > _m_memo;
+    mutable size_t _m_nrComputed;
+
+    /// Stores the (unnormalized) projection of \a b for (a,o) in \a bao.
+    void Project(const JointBeliefInterface &b, Index a, Index o,
+                 JointBelief &bao) const;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Back-projects \a V, up front or (if \a lazy) on demand.
+    BackProjection(const AlphaVectorPlanning &avp,
+                   const ValueFunctionPOMDPDiscrete &V,
+                   bool lazy);
+    /// Destructor.
+    ~BackProjection();
+
+    bool IsLazy() const { return(_m_lazy); }
+    /// Returns the number of vectors that have been back-projected.
+    size_t GetNrComputed() const { return(_m_nrComputed); }
+
+    /// Returns the k that maximizes the value of \a b under g_ao^k.
+    int GetMaximizingVectorIndex(const JointBeliefInterface &b,
+                                 Index a, Index o) const;
+
+    /**\brief Maximizes the value of \a b under g_ao^k over the k
+     * enabled in each of \a masks.
+     *
+     * indices[i] is -1 if no vector is enabled in masks[i], in which
+     * case values[i] is -DBL_MAX. */
+    void GetMaximizingVectorIndices(const JointBeliefInterface &b,
+                                    Index a, Index o,
+                                    const std::vector<std::vector<bool> >
+                                    &masks,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &values) const;
+
+    /// Returns g_ao^k, which has GetNrStates() entries.
+    const Scalar* GetVector(Index a, Index o, Index k) const;
+};
+
+
+#endif /* !_BACKPROJECTION_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -199,6 +199,11 @@ class BayesianGameForDecPOMDPStage :
         //get (data) functions:
         const PlanningUnitDecPOMDPDiscrete* GetPUDecPOMDPDiscrete() const
         {return _m_pu;}
+        const QFunctionJAOHInterface* GetQHeuristic() const
+        {return _m_qHeuristic;}
+        /// Returns the joint belief induced by joint type jtI.
+        const JointBeliefInterface* GetJointBelief(Index jtI) const
+        {return _m_JBs.at(jtI);}
        
         /** Prints a description of this  entire BayesianGameIdenticalPayoff 
          * to a string.*/
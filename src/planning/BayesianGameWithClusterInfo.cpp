@@ -0,0 +1,295 @@
+/**\file BayesianGameWithClusterInfo.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include <map>
+#include <cmath>
+#include "BayesianGameWithClusterInfo.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+#include "JointBeliefInterface.h"
+#include "IndexTools.h"
+
+using namespace std;
+
+/// The precision with which probabilities, beliefs and utilities are compared.
+static const double CLUSTER_PRECISION = 1e-9;
+
+static double Quantize(double x)
+{
+    return(floor(x / CLUSTER_PRECISION + 0.5));
+}
+
+/**Merges the probabilities, joint beliefs and utilities of the joint
+ * clusters of a BG with nrC clusters per agent into those of a BG in
+ * which the clusters of agentI are mapped by newCluster. Joint clusters
+ * that cannot occur get the unweighted average belief and utilities.*/
+static void MergeClusters(Index agentI, const vector<Index>& newCluster,
+                          size_t nrNew, vector<size_t>& nrC,
+                          vector<double>& prob,
+                          vector<vector<double> >& belief,
+                          vector<vector<double> >& util)
+{
+    vector<size_t> newNrC = nrC;
+    newNrC[agentI] = nrNew;
+    size_t nrNewJC = 1;
+    for(Index agI=0; agI < newNrC.size(); agI++)
+        nrNewJC *= newNrC[agI];
+    size_t nrS = belief.empty() ? 0 : belief[0].size();
+    size_t nrJA = util.empty() ? 0 : util[0].size();
+
+    vector<double> newProb(nrNewJC, 0.0);
+    vector<vector<double> > newBelief(nrNewJC, vector<double>(nrS, 0.0)),
+        newUtil(nrNewJC, vector<double>(nrJA, 0.0)),
+        avgBelief(nrNewJC, vector<double>(nrS, 0.0)),
+        avgUtil(nrNewJC, vector<double>(nrJA, 0.0));
+    vector<size_t> nrMembers(nrNewJC, 0);
+    for(Index jc=0; jc < prob.size(); jc++)
+    {
+        vector<Index> c = IndexTools::JointToIndividualIndices(jc, nrC);
+        c[agentI] = newCluster[c[agentI]];
+        Index newJC = IndexTools::IndividualToJointIndices(c, newNrC);
+        double p = prob[jc];
+        newProb[newJC] += p;
+        nrMembers[newJC]++;
+        for(Index sI=0; sI < nrS; sI++)
+        {
+            newBelief[newJC][sI] += p * belief[jc][sI];
+            avgBelief[newJC][sI] += belief[jc][sI];
+        }
+        for(Index jaI=0; jaI < nrJA; jaI++)
+        {
+            newUtil[newJC][jaI] += p * util[jc][jaI];
+            avgUtil[newJC][jaI] += util[jc][jaI];
+        }
+    }
+    for(Index jc=0; jc < nrNewJC; jc++)
+    {
+        if(newProb[jc] > 0)
+        {
+            for(Index sI=0; sI < nrS; sI++)
+                newBelief[jc][sI] /= newProb[jc];
+            for(Index jaI=0; jaI < nrJA; jaI++)
+                newUtil[jc][jaI] /= newProb[jc];
+        }
+        else
+        {
+            for(Index sI=0; sI < nrS; sI++)
+                newBelief[jc][sI] = avgBelief[jc][sI] / nrMembers[jc];
+            for(Index jaI=0; jaI < nrJA; jaI++)
+                newUtil[jc][jaI] = avgUtil[jc][jaI] / nrMembers[jc];
+        }
+    }
+
+    nrC = newNrC;
+    prob.swap(newProb);
+    belief.swap(newBelief);
+    util.swap(newUtil);
+}
+
+BayesianGameWithClusterInfo::BayesianGameWithClusterInfo(
+    const BayesianGameForDecPOMDPStage& bg,
+    const vector<vector<Index> >& typeClusters) :
+    BayesianGameForDecPOMDPStage(bg.GetPUDecPOMDPDiscrete(),
+                                 bg.GetQHeuristic(),
+                                 bg.GetStage(),
+                                 bg.GetNrAgents(),
+                                 bg.GetNrActions(),
+                                 GetNrClusters(typeClusters)),
+    _m_typeClusters(typeClusters)
+{
+    _m_pJPol = bg.GetPastJointPolicy();
+
+    size_t nrAgents = GetNrAgents();
+    size_t nrJA = GetNrJointActions();
+    size_t nrS = _m_pu->GetNrStates();
+    size_t nrJC = GetNrJointTypes();
+
+    vector<double> prob(nrJC, 0.0);
+    vector<vector<double> > belief(nrJC, vector<double>(nrS, 0.0)),
+        util(nrJC, vector<double>(nrJA, 0.0));
+    vector<size_t> nrMembers(nrJC, 0);
+    vector<bool> isPossible(nrJC, false);
+    vector<Index> c(nrAgents);
+    for(Index jt=0; jt < bg.GetNrJointTypes(); jt++)
+    {
+        const vector<Index>& types = bg.JointToIndividualTypeIndices(jt);
+        for(Index agI=0; agI < nrAgents; agI++)
+            c[agI] = _m_typeClusters[agI][types[agI]];
+        Index jc = IndividualToJointTypeIndices(c);
+
+        double p = bg.GetProbability(jt);
+        // joint clusters that cannot occur get the unweighted average
+        if(p > 0 && !isPossible[jc])
+        {
+            isPossible[jc] = true;
+            nrMembers[jc] = 0;
+            fill(belief[jc].begin(), belief[jc].end(), 0.0);
+            fill(util[jc].begin(), util[jc].end(), 0.0);
+        }
+        else if(p <= 0 && isPossible[jc])
+            continue;
+        double w = isPossible[jc] ? p : 1.0;
+
+        prob[jc] += p;
+        nrMembers[jc]++;
+        const JointBeliefInterface* jb = bg.GetJointBelief(jt);
+        for(Index sI=0; sI < nrS; sI++)
+            belief[jc][sI] += w * jb->Get(sI);
+        for(Index jaI=0; jaI < nrJA; jaI++)
+            util[jc][jaI] += w * bg.GetUtility(jt, jaI);
+    }
+
+    for(Index jc=0; jc < nrJC; jc++)
+    {
+        double norm = isPossible[jc] ? prob[jc] : nrMembers[jc];
+        for(Index sI=0; sI < nrS; sI++)
+            belief[jc][sI] /= norm;
+        JointBeliefInterface* jb = _m_pu->GetNewJointBeliefInterface();
+        jb->Set(belief[jc]);
+        _m_JBs.at(jc) = jb;
+
+        SetProbability(jc, prob[jc]);
+        for(Index jaI=0; jaI < nrJA; jaI++)
+            SetUtility(jc, jaI, util[jc][jaI] / norm);
+    }
+}
+
+vector<size_t> BayesianGameWithClusterInfo::GetNrClusters(
+    const vector<vector<Index> >& typeClusters)
+{
+    vector<size_t> nrClusters(typeClusters.size(), 0);
+    for(Index agI=0; agI < typeClusters.size(); agI++)
+        for(Index tI=0; tI < typeClusters[agI].size(); tI++)
+            if(typeClusters[agI][tI] >= nrClusters[agI])
+                nrClusters[agI] = typeClusters[agI][tI] + 1;
+    return(nrClusters);
+}
+
+vector<vector<Index> > BayesianGameWithClusterInfo::ClusterTypes(
+    const BayesianGameForDecPOMDPStage& bg)
+{
+    size_t nrAgents = bg.GetNrAgents();
+    size_t nrJA = bg.GetNrJointActions();
+    size_t nrS = bg.GetPUDecPOMDPDiscrete()->GetNrStates();
+
+    vector<vector<Index> > typeClusters(nrAgents);
+    for(Index agI=0; agI < nrAgents; agI++)
+        for(Index tI=0; tI < bg.GetNrTypes(agI); tI++)
+            typeClusters[agI].push_back(tI);
+
+    // the BG over the current clusters, which starts as bg itself
+    vector<size_t> nrC = bg.GetNrTypes();
+    size_t nrJC = bg.GetNrJointTypes();
+    vector<double> prob(nrJC);
+    vector<vector<double> > belief(nrJC, vector<double>(nrS)),
+        util(nrJC, vector<double>(nrJA));
+    for(Index jc=0; jc < nrJC; jc++)
+    {
+        prob[jc] = bg.GetProbability(jc);
+        const JointBeliefInterface* jb = bg.GetJointBelief(jc);
+        for(Index sI=0; sI < nrS; sI++)
+            belief[jc][sI] = jb->Get(sI);
+        for(Index jaI=0; jaI < nrJA; jaI++)
+            util[jc][jaI] = bg.GetUtility(jc, jaI);
+    }
+
+    // cluster the agents in turn, until a full round merges nothing
+    size_t nrUnchanged = 0;
+    for(Index agentI=0; nrUnchanged < nrAgents; agentI=(agentI+1)%nrAgents)
+    {
+        size_t nrCi = nrC[agentI];
+        vector<double> probCi(nrCi, 0.0);
+        for(Index jc=0; jc < prob.size(); jc++)
+            probCi[IndexTools::JointToIndividualIndices(jc, nrC)[agentI]] +=
+                prob[jc];
+
+        // The signature of a cluster lists, for each cluster of the other
+        // agents (in joint index order), the conditional probability
+        // and, if it is possible, the joint belief and utilities. Clusters
+        // that cannot occur get an empty signature, and are merged.
+        vector<vector<double> > signature(nrCi);
+        for(Index jc=0; jc < prob.size(); jc++)
+        {
+            Index ci = IndexTools::JointToIndividualIndices(jc, nrC)[agentI];
+            if(probCi[ci] <= 0)
+                continue;
+            vector<double>& sig = signature[ci];
+            sig.push_back(Quantize(prob[jc] / probCi[ci]));
+            if(prob[jc] > 0)
+            {
+                for(Index sI=0; sI < nrS; sI++)
+                    sig.push_back(Quantize(belief[jc][sI]));
+                for(Index jaI=0; jaI < nrJA; jaI++)
+                    sig.push_back(Quantize(util[jc][jaI]));
+            }
+        }
+
+        map<vector<double>, Index> clusterOf;
+        vector<Index> newCluster(nrCi);
+        for(Index ci=0; ci < nrCi; ci++)
+        {
+            map<vector<double>, Index>::const_iterator it =
+                clusterOf.find(signature[ci]);
+            if(it == clusterOf.end())
+            {
+                newCluster[ci] = clusterOf.size();
+                clusterOf[signature[ci]] = newCluster[ci];
+            }
+            else
+                newCluster[ci] = it->second;
+        }
+
+        if(clusterOf.size() == nrCi)
+        {
+            nrUnchanged++;
+            continue;
+        }
+        nrUnchanged = 1;
+
+        for(Index tI=0; tI < typeClusters[agentI].size(); tI++)
+            typeClusters[agentI][tI] = newCluster[typeClusters[agentI][tI]];
+        MergeClusters(agentI, newCluster, clusterOf.size(), nrC,
+                      prob, belief, util);
+    }
+
+    return(typeClusters);
+}
+
+string BayesianGameWithClusterInfo::SoftPrint() const
+{
+    stringstream ss;
+    ss << "Clustered ";
+    ss << BayesianGameForDecPOMDPStage::SoftPrint();
+    ss << "Clusters of the types of the original BG:" << endl;
+    for(Index agI=0; agI < _m_typeClusters.size(); agI++)
+    {
+        ss << "agent " << agI << ": ";
+        for(Index tI=0; tI < _m_typeClusters[agI].size(); tI++)
+            ss << _m_typeClusters[agI][tI] << " ";
+        ss << endl;
+    }
+    return(ss.str());
+}
@@ -0,0 +1,106 @@
+/**\file BayesianGameWithClusterInfo.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _BAYESIANGAMEWITHCLUSTERINFO_H_
+#define _BAYESIANGAMEWITHCLUSTERINFO_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include <vector>
+#include "Globals.h"
+#include "BayesianGameForDecPOMDPStage.h"
+
+/**\brief BayesianGameWithClusterInfo is a BayesianGameForDecPOMDPStage
+ * in which the probabilistically equivalent types of each agent are
+ * clustered.
+ *
+ * Two types of an agent are equivalent when they induce the same
+ * distribution over the types of the other agents and, for each of
+ * those, the same joint belief and the same utilities. Such types can
+ * always be given the same action without losing value, so the
+ * clustered BG has the same optimal value as the original one, but
+ * (potentially a lot) fewer joint policies. Clustering the types of one
+ * agent can make types of another agent equivalent, so ClusterTypes()
+ * repeats it for all agents until no more types are merged.
+ *
+ * The types of this BG are the clusters, GetTypeClusters() maps the
+ * types of the original BG (i.e., the observation histories of the
+ * stage) to them.
+ */
+class BayesianGameWithClusterInfo : public BayesianGameForDecPOMDPStage
+{
+private:
+    /// For each agent, the cluster of each type of the original BG.
+    std::vector<std::vector<Index> > _m_typeClusters;
+
+    /// Returns the nr. of clusters of each agent in typeClusters.
+    static std::vector<size_t> GetNrClusters(
+        const std::vector<std::vector<Index> >& typeClusters);
+
+protected:
+
+public:
+    // Constructor, destructor and copy assignment.
+    /**\brief Constructs the BG over the clusters typeClusters of the
+     * types of bg.
+     *
+     * The probability of a joint cluster is the summed probability of
+     * its joint types, its joint belief and utilities are the
+     * probability-weighted averages over those joint types. bg can be
+     * deleted afterwards.*/
+    BayesianGameWithClusterInfo(
+        const BayesianGameForDecPOMDPStage& bg,
+        const std::vector<std::vector<Index> >& typeClusters);
+
+    /**\brief Returns, for each agent, the cluster of each type of bg.
+     *
+     * Clusters are numbered from 0 in order of their first type. If
+     * no types are equivalent each type forms its own cluster.*/
+    static std::vector<std::vector<Index> > ClusterTypes(
+        const BayesianGameForDecPOMDPStage& bg);
+
+    /// Returns, for each agent, the cluster of each type of the original BG.
+    const std::vector<std::vector<Index> >& GetTypeClusters() const
+        { return(_m_typeClusters); }
+
+    /// Returns the cluster of the typeI-th type of agentI of the original BG.
+    Index GetCluster(Index agentI, Index typeI) const
+        { return(_m_typeClusters.at(agentI).at(typeI)); }
+
+    std::string SoftPrint() const;
+    void Print() const
+        { std::cout << SoftPrint();}
+};
+
+
+#endif /* !_BAYESIANGAMEWITHCLUSTERINFO_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
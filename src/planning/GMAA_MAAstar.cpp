@@ -75,16 +75,14 @@ bool GMAA_MAAstar::ConstructAndValuateNextPolicies(
     // Construct the bayesian game for this timestep - 
     //BayesianGameIdenticalPayoff *bg_ts=ConstructBayesianGame(jpolPrevTs,
             //nrOHts, nrJOHts, firstOHtsI, ExpR_0_prevTS);
-    BayesianGameForDecPOMDPStage *bg_ts= new BayesianGameForDecPOMDPStage(
-            this,
-            _m_qHeuristic,
-            jpolPrevTs
-            );
+    const vector<vector<Index> >* typeClusters;
+    BayesianGameForDecPOMDPStage *bg_ts=ConstructBayesianGame(jpolPrevTs,
+                                                              typeClusters);
     // This also returns ExpR_0_prevTS (the expected reward for time-steps
     // 0...ts-1 (given jpolPrevTs) ),  nrOHts, nrJOHts and firstOHtsI.
 //    double ExpR_0_prevTS = bg_ts->GetPastReward();
 
-    const vector<size_t>& nrOHts = bg_ts->GetNrTypes(); 
+    const vector<size_t> nrOHts = GetNrObservationHistoriesVector(ts);
 #if DEBUG_GMAA3
     if(_m_verboseness >= 3) {
         cout << "Constructed BG:"<<endl;
@@ -160,18 +158,14 @@ bool GMAA_MAAstar::ConstructAndValuateNextPolicies(
             //not the last time step...construct and return all 
             //partial DecPOMDP policies,
             
-            // construct a policy for the DecPOMDP: a copy of jpolPrevTs
-            // extended to this time step (ts) by jpolBG
-            PartialJointPolicyDiscretePure* jpolTs = 
-                ConstructExtendedJointPolicy(*jpolPrevTs,
-                    jpolBG, nrOHts, firstOHtsI);
-            jpolTs->SetPastReward(newPastReward);
-
-            // wrap the policy and put it in the pool of next policies.
+            // construct a policy for the DecPOMDP: jpolPrevTs
+            // extended to this time step (ts) by jpolBG, wrap it and put
+            // it in the pool of next policies.
             // (these next policies are candidates to be added to the 
             // main policy pool)
-            // Warning: jpolTs may have been deleted afterwards
-            poolOfNextPolicies->Insert( NewPPI(jpolTs, v) );
+            poolOfNextPolicies->Insert( ConstructExtendedPPI(ppi,
+                    *jpolPrevTs, jpolBG, nrOHts, firstOHtsI,
+                    newPastReward, v, typeClusters) );
 
             // conserve memory 
             // is this necessary?  - this is performed by 
@@ -217,15 +211,14 @@ bool GMAA_MAAstar::ConstructAndValuateNextPolicies(
     if(is_last_ts) 
     {
 
-        PartialJointPolicyDiscretePure* jpolTs = ConstructExtendedJointPolicy(
+        poolOfNextPolicies->Insert( ConstructExtendedPPI(ppi,
                 *jpolPrevTs,
                 bestLBjpolBG, 
                 nrOHts, 
-                firstOHtsI
-                );
-        jpolTs->SetPastReward(newPastReward);
-        // Warning: jpolTs may have been deleted afterwards
-        poolOfNextPolicies->Insert( NewPPI(jpolTs, maxLBv ) );
+                firstOHtsI,
+                newPastReward,
+                maxLBv,
+                typeClusters ) );
     }
 
     if(_m_verboseness >= 2) 
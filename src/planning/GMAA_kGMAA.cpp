@@ -63,11 +63,9 @@ bool GMAA_kGMAA::ConstructAndValuateNextPolicies(
     for(Index agI=0; agI < GetNrAgents(); agI++)
         firstOHtsI.at(agI) = GetFirstObservationHistoryIndex(agI, ts);
     // Construct the bayesian game for this timestep - 
-    BayesianGameForDecPOMDPStage *bg_ts= new BayesianGameForDecPOMDPStage(
-            this,
-            _m_qHeuristic,
-            jpolPrevTs
-            );
+    const vector<vector<Index> >* typeClusters;
+    BayesianGameForDecPOMDPStage *bg_ts=ConstructBayesianGame(jpolPrevTs,
+                                                              typeClusters);
 
     _m_bgCounter++;
     if(_m_bgBaseFilename!="")
@@ -78,7 +76,7 @@ bool GMAA_kGMAA::ConstructAndValuateNextPolicies(
     }
 
     double prevPastReward = jpolPrevTs->GetPastReward();
-    const vector<size_t>& nrOHts = bg_ts->GetNrTypes(); 
+    const vector<size_t> nrOHts = GetNrObservationHistoriesVector(ts);
     //size_t nrJOHts = bg_ts->GetNrJointTypes(); 
 
     //The set of Indicies of the policies added to poolOfNextPolicies
@@ -114,21 +112,16 @@ bool GMAA_kGMAA::ConstructAndValuateNextPolicies(
         double val = jpvp->GetValue();
 
         solution.PopNextSolutionJPPV();
-        PartialJointPolicyDiscretePure* jpolTs = 
-            ConstructExtendedJointPolicy(*jpolPrevTs,
-                                    *bgpol, nrOHts, firstOHtsI);
         //compute expected immediate reward for this stage
         double immR = bg_ts->ComputeDiscountedImmediateRewardForJPol(bgpol);
         double newPastreward = prevPastReward + immR;
-        jpolTs->SetPastReward(newPastreward);
         //push this policy and value on the priority queue
         ////if last stage, if so, we want to return the 
         ////*EXACT* past reward, newPastreward.
-        if(is_last_ts)
-            poolOfNextPolicies->Insert( NewPPI(jpolTs,newPastreward) );
-        else
-            poolOfNextPolicies->Insert( NewPPI(jpolTs,
-                                        val + prevPastReward) );
+        double v = is_last_ts ? newPastreward : val + prevPastReward;
+        poolOfNextPolicies->Insert( ConstructExtendedPPI(ppi,
+                                    *jpolPrevTs, *bgpol, nrOHts, firstOHtsI,
+                                    newPastreward, v, typeClusters) );
         delete jpvp;
     }
     //empty the imm reward cache
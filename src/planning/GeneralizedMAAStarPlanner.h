@@ -231,6 +231,8 @@ class GeneralizedMAAStarPlanner :
          *              (this functions
          *              as the offset in the conversion BG->DecPOMDP index 
          *              conversion).
+         * typeClusters - if not 0, the type of the BG of each observation
+         *              history in time step ts for each agent.
          *
          * returns a new JointPolicyPureVector (so it must be explicitly 
          * deleted)
@@ -239,7 +241,8 @@ class GeneralizedMAAStarPlanner :
                 const PartialJointPolicyDiscretePure& jpolPrevTs
                 , const JointPolicyDiscretePure& jpolBG
                 , const std::vector<size_t>& nrOHts
-                , const std::vector<Index>& firstOHtsI) = 0;
+                , const std::vector<Index>& firstOHtsI
+                , const std::vector<std::vector<Index> >* typeClusters=0) = 0;
 /* this uses GetNrAgents() and should therefore not be put here...
         //for convenience we also provide a possible implementation here
         PartialJointPolicyPureVector* ConstructExtendedJointPolicyPureVector(
@@ -33,7 +33,9 @@
 
 #include "PartialJointPolicyPureVector.h"
 #include "PartialJPDPValuePair.h"
+#include "PartialJPPVStagedValuePair.h"
 #include "PolicyPoolPartialJPolValPair.h"
+#include "BayesianGameWithClusterInfo.h"
 
 //#include "JointObservationHistoryTree.h"
 //#include "JointBeliefInterface.h"
@@ -54,6 +56,8 @@ GeneralizedMAAStarPlannerForDecPOMDPDiscrete::GeneralizedMAAStarPlannerForDecPOM
     ,GeneralizedMAAStarPlanner(verboseness)
 {
     _m_qHeuristic=0;
+    _m_compactPolicyPool=true;
+    _m_useClustering=false;
     _m_useSparseBeliefs=GetParams().GetUseSparseJointBeliefs();
 }
 
@@ -65,6 +69,8 @@ GeneralizedMAAStarPlannerForDecPOMDPDiscrete(
     PlanningUnitDecPOMDPDiscrete(horizon, p)
 {
     _m_qHeuristic=0;
+    _m_compactPolicyPool=true;
+    _m_useClustering=false;
     _m_useSparseBeliefs=GetParams().GetUseSparseJointBeliefs();
 }
 
@@ -90,7 +96,8 @@ PartialJointPolicyDiscretePure* GeneralizedMAAStarPlannerForDecPOMDPDiscrete::Co
         const PartialJointPolicyDiscretePure& jpolPrevTs, 
         const JointPolicyDiscretePure& jpolBG,
         const vector<size_t>& nrOHts, 
-        const vector<Index>& firstOHtsI)
+        const vector<Index>& firstOHtsI,
+        const vector<vector<Index> >* typeClusters)
 {
     //check policy types
     if(jpolPrevTs.GetIndexDomainCategory() != PolicyGlobals::OHIST_INDEX)
@@ -108,13 +115,79 @@ PartialJointPolicyDiscretePure* GeneralizedMAAStarPlannerForDecPOMDPDiscrete::Co
         for(Index type = 0; type < nrOHts[agentI]; type++)
         {
             Index ohI = type + firstOHtsI[agentI];
+            Index bgType = typeClusters ? (*typeClusters)[agentI][type] : type;
             jpolTs->SetAction(agentI, ohI, 
-                    jpolBG.GetActionIndex(agentI, type) );
+                    jpolBG.GetActionIndex(agentI, bgType) );
         }         
     }
     return(jpolTs);
 }
 
+PartialPolicyPoolItemInterface*
+GeneralizedMAAStarPlannerForDecPOMDPDiscrete::ConstructExtendedPPI(
+        PartialPolicyPoolItemInterface* ppi,
+        const PartialJointPolicyDiscretePure& jpolPrevTs, 
+        const JointPolicyDiscretePure& jpolBG,
+        const vector<size_t>& nrOHts, 
+        const vector<Index>& firstOHtsI,
+        double pastReward,
+        double v,
+        const vector<vector<Index> >* typeClusters)
+{
+    if(_m_compactPolicyPool)
+    {
+        //the stages of jpolPrevTs can be shared if ppi already is a
+        //staged item, or if there are no stages yet (i.e., the empty
+        //policy the pool is initialized with)
+        PartialJPPVStagedValuePair* staged = 
+            dynamic_cast<PartialJPPVStagedValuePair*>(ppi);
+        if(staged != 0 || jpolPrevTs.GetDepth() == 0)
+        {
+            boost::shared_ptr<const PartialJPPVStage> parent;
+            if(staged != 0)
+                parent = staged->GetStage();
+            boost::shared_ptr<const PartialJPPVStage> stage(
+                new PartialJPPVStage(parent, jpolPrevTs.GetDepth()+1,
+                                     jpolBG, nrOHts, firstOHtsI,
+                                     PartialJPPVStage::GetBytesPerAction(
+                                         *this),
+                                     typeClusters));
+            return(new PartialJPPVStagedValuePair(stage, this,
+                                                  pastReward, v));
+        }
+    }
+
+    PartialJointPolicyDiscretePure* jpolTs = 
+        ConstructExtendedJointPolicy(jpolPrevTs, jpolBG, nrOHts, firstOHtsI,
+                                     typeClusters);
+    jpolTs->SetPastReward(pastReward);
+    return(NewPPI(jpolTs, v));
+}
+
+BayesianGameForDecPOMDPStage*
+GeneralizedMAAStarPlannerForDecPOMDPDiscrete::ConstructBayesianGame(
+        const PartialJointPolicyDiscretePure* jpolPrevTs,
+        const vector<vector<Index> >*& typeClusters)
+{
+    BayesianGameForDecPOMDPStage *bg_ts = new BayesianGameForDecPOMDPStage(
+            this,
+            _m_qHeuristic,
+            jpolPrevTs
+            );
+    typeClusters = 0;
+    if(!_m_useClustering)
+        return(bg_ts);
+
+    BayesianGameWithClusterInfo *bgc = new BayesianGameWithClusterInfo(
+        *bg_ts, BayesianGameWithClusterInfo::ClusterTypes(*bg_ts));
+    if(_m_verboseness >= 2)
+        cout << "Clustered the BG for t=" << bgc->GetStage() << " from "
+             << bg_ts->GetNrJointTypes() << " to " << bgc->GetNrJointTypes()
+             << " joint types" << endl;
+    delete bg_ts;
+    typeClusters = &bgc->GetTypeClusters();
+    return(bgc);
+}
 
 PartialJointPolicyDiscretePure* GeneralizedMAAStarPlannerForDecPOMDPDiscrete::
 NewJPol() const
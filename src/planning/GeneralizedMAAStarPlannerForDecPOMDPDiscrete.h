@@ -42,6 +42,8 @@
 //needed becaise of inline at bottom of file
 #include "QFunctionJAOHInterface.h"
 
+class BayesianGameForDecPOMDPStage;
+
 
 
 /**\brief GeneralizedMAAStarPlannerForDecPOMDPDiscrete is a class that 
@@ -79,6 +81,11 @@ class GeneralizedMAAStarPlannerForDecPOMDPDiscrete :
         //GeneralizedMAAStarPlannerForDecPOMDPDiscrete
         QFunctionJAOHInterface* _m_qHeuristic;
 
+        ///Whether the policy pool stores only the last stage of each policy.
+        bool _m_compactPolicyPool;
+        ///Whether equivalent types of the BGs are clustered.
+        bool _m_useClustering;
+
 //Functions that can be overriden by derived classes to influence the working of
 //GMAA:
         
@@ -112,6 +119,10 @@ class GeneralizedMAAStarPlannerForDecPOMDPDiscrete :
          *              (this functions
          *              as the offset in the conversion BG->DecPOMDP index 
          *              conversion).
+         * typeClusters - if the BG is clustered, the cluster (i.e., the
+         *              type of the BG) of each observation history in 
+         *              time step ts for each agent (see 
+         *              BayesianGameWithClusterInfo). 
          *
          * returns a new JointPolicyPureVector (so it must be explicitly 
          * deleted)
@@ -120,7 +131,39 @@ class GeneralizedMAAStarPlannerForDecPOMDPDiscrete :
                 const PartialJointPolicyDiscretePure& jpolPrevTs
                 , const JointPolicyDiscretePure& jpolBG
                 , const std::vector<size_t>& nrOHts
-                , const std::vector<Index>& firstOHtsI);
+                , const std::vector<Index>& firstOHtsI
+                , const std::vector<std::vector<Index> >* typeClusters=0);
+
+        /**\brief Extends the policy of ppi to the next stage and wraps it
+         * in a new PartialPolicyPoolItemInterface.
+         *
+         * The arguments are as for ConstructExtendedJointPolicy(), where
+         * jpolPrevTs is the policy wrapped by ppi.
+         *
+         * When the compact policy pool is used (the default), the
+         * returned item is a PartialJPPVStagedValuePair that only stores
+         * the actions for time step ts, and shares the earlier stages with
+         * ppi. Otherwise this is the same as ConstructExtendedJointPolicy()
+         * followed by NewPPI().
+         */
+        virtual PartialPolicyPoolItemInterface* ConstructExtendedPPI(
+                PartialPolicyPoolItemInterface* ppi
+                , const PartialJointPolicyDiscretePure& jpolPrevTs
+                , const JointPolicyDiscretePure& jpolBG
+                , const std::vector<size_t>& nrOHts
+                , const std::vector<Index>& firstOHtsI
+                , double pastReward
+                , double v
+                , const std::vector<std::vector<Index> >* typeClusters=0);
+
+        /**\brief Constructs the BG for the stage after jpolPrevTs.
+         *
+         * When clustering is used this is a BayesianGameWithClusterInfo
+         * and typeClusters is set to its clusters, otherwise it is set
+         * to 0. The caller should delete the BG.*/
+        BayesianGameForDecPOMDPStage* ConstructBayesianGame(
+                const PartialJointPolicyDiscretePure* jpolPrevTs
+                , const std::vector<std::vector<Index> >*& typeClusters);
 
 
         inline
@@ -150,6 +193,14 @@ class GeneralizedMAAStarPlannerForDecPOMDPDiscrete :
             {_m_qHeuristic = &q;}
         void SetQHeuristic(QFunctionJAOHInterface* q)
             {_m_qHeuristic = q;}
+        /**\brief Sets whether partial policies in the pool share their
+         * earlier stages (see ConstructExtendedPPI()).*/
+        void SetCompactPolicyPool(bool compact)
+            {_m_compactPolicyPool = compact;}
+        /**\brief Sets whether probabilistically equivalent types of the
+         * BGs are clustered (see BayesianGameWithClusterInfo).*/
+        void SetUseClustering(bool useClustering)
+            {_m_useClustering = useClustering;}
 
         virtual GeneralizedMAAStarPlannerForDecPOMDPDiscrete* 
             GetThisFromMostDerivedPU()
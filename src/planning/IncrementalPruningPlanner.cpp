@@ -0,0 +1,207 @@
+/**\file IncrementalPruningPlanner.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "IncrementalPruningPlanner.h"
+#include <float.h>
+#include "BeliefValue.h"
+#include "AlphaVector.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+
+using namespace std;
+
+#define DEBUG_IncrementalPruningPlanner 0
+
+//Default constructor
+IncrementalPruningPlanner::IncrementalPruningPlanner(const 
+                                                     PlanningUnitDecPOMDPDiscrete&
+                                                     pu) :
+    AlphaVectorPlanning(pu),
+    AlphaVectorPOMDP(pu),
+    _m_verbose(0),
+    _m_maximumNumberOfIterations(1000),
+    _m_convergenceThreshold(1e-4)
+{
+    AlphaVectorPlanning::Initialize();
+}
+
+//Destructor
+IncrementalPruningPlanner::~IncrementalPruningPlanner()
+{
+}
+
+void IncrementalPruningPlanner::Plan()
+{
+    StartTimer("IncrementalPruning::Plan");
+
+    size_t horizon=GetPU()->GetHorizon(),
+        nrA=GetPU()->GetNrJointActions();
+    _m_qFunctions.clear();
+
+    // the last stage only gets the immediate reward
+    ValueFunctionPOMDPDiscrete R=GetImmediateRewardValueFunction();
+    QFunctionsDiscrete Q(nrA);
+    for(Index a=0;a!=nrA;a++)
+        Q[a].push_back(R[a]);
+    ValueFunctionPOMDPDiscrete V=Prune(R);
+
+    if(horizon==MAXHORIZON)
+    {
+        for(size_t iter=1;;iter++)
+        {
+            Q=BackupStage(V);
+            ValueFunctionPOMDPDiscrete V1=Prune(QFunctionsToValueFunction(Q));
+            double maxDiff=GetMaxDifferenceBound(V,V1);
+            if(GetVerbose() >= 0)
+                cout << "IncrementalPruning: iteration " << iter << " |V| "
+                     << V1.size() << " maxDiff " << maxDiff << endl;
+            V=V1;
+            if(maxDiff<_m_convergenceThreshold ||
+               iter>=_m_maximumNumberOfIterations)
+                break;
+        }
+        _m_qFunctions.push_back(Q);
+    }
+    else if(horizon>0)
+    {
+        _m_qFunctions.resize(horizon);
+        _m_qFunctions[horizon-1]=Q;
+        for(int t=horizon-2;t>=0;t--)
+        {
+            _m_qFunctions[t]=BackupStage(V);
+            V=Prune(QFunctionsToValueFunction(_m_qFunctions[t]));
+            if(GetVerbose() >= 0)
+                cout << "IncrementalPruning: stage " << t << " |V| "
+                     << V.size() << endl;
+        }
+    }
+
+    StopTimer("IncrementalPruning::Plan");
+}
+
+QFunctionsDiscrete
+IncrementalPruningPlanner::BackupStage(const ValueFunctionPOMDPDiscrete &V)
+    const
+{
+    int nrA=GetPU()->GetNrJointActions(),
+        nrO=GetPU()->GetNrJointObservations();
+
+    GaoVectorSet G=BackProjectMonahan(V);
+
+    QFunctionsDiscrete Q(nrA);
+#pragma omp parallel for schedule(dynamic)
+    for(int a=0;a<nrA;a++)
+        MonahanCrossSum(G,Q[a],a,true);
+
+    for(int a=0;a!=nrA;a++)
+        for(int o=0;o!=nrO;o++)
+            delete(G[a][o]);
+
+#if DEBUG_IncrementalPruningPlanner
+    for(int a=0;a!=nrA;a++)
+        cout << "IncrementalPruningPlanner::BackupStage |Q_" << a << "| "
+             << Q[a].size() << endl;
+#endif
+
+    return(Q);
+}
+
+const QFunctionsDiscrete&
+IncrementalPruningPlanner::GetQFunctions(Index t) const
+{
+    if(_m_qFunctions.empty())
+        throw(E("IncrementalPruningPlanner: Plan() has not been called"));
+    if(_m_qFunctions.size()==1)
+        return(_m_qFunctions[0]);
+    return(_m_qFunctions.at(t));
+}
+
+ValueFunctionPOMDPDiscrete IncrementalPruningPlanner::GetValueFunction() const
+{
+    return(Prune(QFunctionsToValueFunction(GetQFunctions(0))));
+}
+
+double IncrementalPruningPlanner::GetQ(const JointBeliefInterface &b,
+                                       Index jaI) const
+{
+    return(GetQ(b,0,jaI));
+}
+
+double IncrementalPruningPlanner::GetQ(const JointBeliefInterface &b,
+                                       Index jaI, int &betaMaxI) const
+{
+    return(GetQ(b,0,jaI,betaMaxI));
+}
+
+double IncrementalPruningPlanner::GetQ(const JointBeliefInterface &b,
+                                       Index t, Index jaI) const
+{
+    return(BeliefValue::GetValue(b,GetQFunctions(t)[jaI]));
+}
+
+double IncrementalPruningPlanner::GetQ(const JointBeliefInterface &b,
+                                       Index t, Index jaI,
+                                       int &betaMaxI) const
+{
+    const ValueFunctionPOMDPDiscrete &Q=GetQFunctions(t)[jaI];
+    Index maxI=BeliefValue::GetMaximizingVectorIndex(b,Q);
+    betaMaxI=Q[maxI].GetBetaI();
+    return(b.InnerProduct(Q[maxI].GetValues()));
+}
+
+double IncrementalPruningPlanner::
+GetMaxDifferenceBound(const ValueFunctionPOMDPDiscrete &V0,
+                      const ValueFunctionPOMDPDiscrete &V1)
+{
+    double maxDiff=0;
+    for(int dir=0;dir!=2;dir++)
+    {
+        const ValueFunctionPOMDPDiscrete &A=dir ? V0 : V1,
+            &B=dir ? V1 : V0;
+        for(VFPDcit i=A.begin();i!=A.end();++i)
+        {
+            double minDiff=DBL_MAX;
+            for(VFPDcit j=B.begin();j!=B.end() && minDiff>maxDiff;++j)
+            {
+                double diff=-DBL_MAX;
+                for(Index s=0;s!=i->GetNrValues();s++)
+                    diff=max(diff,i->GetValue(s)-j->GetValue(s));
+                minDiff=min(minDiff,diff);
+            }
+            maxDiff=max(maxDiff,minDiff);
+        }
+    }
+    return(maxDiff);
+}
+
+void IncrementalPruningPlanner::ExportValueFunction(const string &filename)
+    const
+{
+    if(_m_qFunctions.size()==1)
+        AlphaVectorPlanning::ExportValueFunction(filename,_m_qFunctions[0]);
+    else
+        AlphaVectorPlanning::ExportValueFunction(filename,_m_qFunctions);
+}
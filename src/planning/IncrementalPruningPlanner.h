@@ -0,0 +1,128 @@
+/**\file IncrementalPruningPlanner.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _INCREMENTALPRUNINGPLANNER_H_
+#define _INCREMENTALPRUNINGPLANNER_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include "Globals.h"
+
+#include "AlphaVectorPOMDP.h"
+#include "ValueFunctionPOMDPDiscrete.h"
+
+/**\brief IncrementalPruningPlanner computes the exact POMDP value
+ * function of the underlying (centralized) POMDP by incremental
+ * pruning (Cassandra, Littman and Zhang, 1997).
+ *
+ * Each backup back-projects the value function of the next stage
+ * (AlphaVectorPlanning::BackProjectMonahan()) and then, for each
+ * joint action in parallel, interleaves the cross-sums over joint
+ * observations with pruning (AlphaVectorPlanning::MonahanCrossSum()).
+ *
+ * For a finite horizon h it stores the Q functions of all h stages,
+ * such that GetQ(b,t,jaI) is the exact QPOMDP value. For an
+ * infinite horizon it does value iteration until the value function
+ * changes less than the convergence threshold (see
+ * GetMaxDifferenceBound()), or the maximum number of iterations is
+ * reached. The size of the value function can grow very quickly, so
+ * it is only practical for small to medium problems.
+ */
+class IncrementalPruningPlanner : public AlphaVectorPOMDP
+{
+private:    
+
+    int _m_verbose;
+    size_t _m_maximumNumberOfIterations;
+    double _m_convergenceThreshold;
+
+    /**\brief The Q functions of each stage.
+     *
+     * For an infinite horizon there is a single (stationary) one. */
+    QFunctionsDiscreteNonStationary _m_qFunctions;
+
+    /// Computes the Q functions of the stage before the one of \a V.
+    QFunctionsDiscrete BackupStage(const ValueFunctionPOMDPDiscrete &V) const;
+
+    /// Returns the Q functions of stage \a t.
+    const QFunctionsDiscrete& GetQFunctions(Index t) const;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// (default) Constructor
+    IncrementalPruningPlanner(const PlanningUnitDecPOMDPDiscrete& pu);
+    /// Destructor.
+    ~IncrementalPruningPlanner();
+
+    void Plan();
+
+    void SetVerbose(int verbose)
+        { _m_verbose=verbose; }
+    int GetVerbose() const
+        { return(_m_verbose); }
+    /// Sets the maximum number of backups for an infinite horizon.
+    void SetMaximumNumberOfIterations(size_t nr)
+        { _m_maximumNumberOfIterations=nr; }
+    /// Sets the threshold on GetMaxDifferenceBound() for an infinite horizon.
+    void SetConvergenceThreshold(double threshold)
+        { _m_convergenceThreshold=threshold; }
+
+    /// Returns the value function of the first stage.
+    ValueFunctionPOMDPDiscrete GetValueFunction() const;
+
+    /// Returns the Q functions of all stages.
+    const QFunctionsDiscreteNonStationary& GetNonStationaryQFunctions() const
+        { return(_m_qFunctions); }
+
+    double GetQ(const JointBeliefInterface &b, Index jaI) const;
+    double GetQ(const JointBeliefInterface &b, Index jaI,
+                int &betaMaxI) const;
+    double GetQ(const JointBeliefInterface &b, Index t, Index jaI) const;
+    double GetQ(const JointBeliefInterface &b, Index t, Index jaI,
+                int &betaMaxI) const;
+
+    /**\brief Returns an upper bound on max_b |V1(b)-V0(b)|.
+     *
+     * For every vector of V1 its value at any belief exceeds the one
+     * of V0 by at most min_{alpha in V0} max_s (alpha1(s)-alpha(s)),
+     * and vice versa. */
+    static double GetMaxDifferenceBound(const ValueFunctionPOMDPDiscrete &V0,
+                                        const ValueFunctionPOMDPDiscrete &V1);
+
+    /// Exports the Q functions, one file per stage for a finite horizon.
+    void ExportValueFunction(const std::string &filename) const;
+};
+
+
+#endif /* !_INCREMENTALPRUNINGPLANNER_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
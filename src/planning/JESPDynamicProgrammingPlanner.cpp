@@ -31,19 +31,28 @@
 #include "JointBeliefInterface.h"
 #include "IndividualBeliefJESP.h"
 #include <float.h>
+#include <cmath>
 
 using namespace std;
 
 #define DEBUG_DPBR 0
 #define DEBUG_DPJESP 0
 
+///The nr. of observations from which the DP best response is parallelized.
+#define JESP_MIN_NR_OBSERVATIONS_PARALLEL 4
+
+///The precision with which beliefs are compared when clustering histories.
+#define JESP_CLUSTER_PRECISION 1e-12
+
 JESPDynamicProgrammingPlanner::JESPDynamicProgrammingPlanner(
     const PlanningUnitMADPDiscreteParameters &params,
     size_t horizon,
     DecPOMDPDiscreteInterface* p
     ) :
     PlanningUnitDecPOMDPDiscrete(params, horizon, p),
-    _m_foundPolicy(*this)
+    _m_foundPolicy(*this),
+    _m_nrRestarts(1),
+    _m_useClustering(false)
     //,_m_exhBRBestPol(*this)
 {
 }
@@ -53,11 +62,20 @@ JESPDynamicProgrammingPlanner::JESPDynamicProgrammingPlanner(
     DecPOMDPDiscreteInterface* p
     ) :
     PlanningUnitDecPOMDPDiscrete(horizon, p),
-    _m_foundPolicy(*this)
+    _m_foundPolicy(*this),
+    _m_nrRestarts(1),
+    _m_useClustering(false)
     //,_m_exhBRBestPol(*this)
 {
 }
 
+void JESPDynamicProgrammingPlanner::SetNrRestarts(size_t nrRestarts)
+{
+    if(nrRestarts == 0)
+        throw E("JESPDynamicProgrammingPlanner: nrRestarts should be >= 1");
+    _m_nrRestarts = nrRestarts;
+}
+
 void JESPDynamicProgrammingPlanner::Plan()
 {
     if(DEBUG_DPJESP){ 
@@ -65,44 +83,74 @@ void JESPDynamicProgrammingPlanner::Plan()
         cout << "Exhaustive JESP  - Plan() started"<<endl;
         cout << "---------------------------------"<<endl;
     }
+    //the random initializations are done here, as RandomInitialization()
+    //uses the (global) rand() and therefore cannot be called in parallel.
+    //Each restart thus gets its own part of the random number stream.
+    vector<JointPolicyPureVector*> jpols(_m_nrRestarts);
+    vector<double> values(_m_nrRestarts, -DBL_MAX);
+    for(Index r=0; r < _m_nrRestarts; r++)
+    {
+        jpols[r] = new JointPolicyPureVector(*this);
+        jpols[r]->RandomInitialization();
+        //jpols[r]->ZeroInitialization();
+    }
+
+    //the restarts only read the planning unit, so they can run in parallel
+    int nrRestarts = static_cast<int>(_m_nrRestarts);
+#pragma omp parallel for schedule(dynamic) if(nrRestarts > 1)
+    for(int r=0; r < nrRestarts; r++)
+        values[r] = LocalSearch(*jpols[r], r % GetNrAgents());
+
+    //select the best restart afterwards, so the result does not depend on
+    //the order in which the restarts finish
+    Index best = 0;
+    for(Index r=1; r < _m_nrRestarts; r++)
+        if(values[r] > values[best])
+            best = r;
+    _m_foundPolicy = *jpols[best];
+    _m_expectedRewardFoundPolicy = values[best];
+
+    if(DEBUG_DPJESP){ 
+        cout << "Exhaustive JESP  - resulting policy:"<<endl;
+        cout << "------------------------------------"<<endl;
+        _m_foundPolicy.Print();
+    }
+    for(Index r=0; r < _m_nrRestarts; r++)
+        delete jpols[r];
+}
+
+double JESPDynamicProgrammingPlanner::LocalSearch(JointPolicyPureVector& jpol,
+                                                  Index agentI)
+{
     double v_best = -DBL_MAX;
-    JointPolicyPureVector* jpol = new JointPolicyPureVector(*this);
-    JointPolicyPureVector* best = new JointPolicyPureVector(*this);
-    jpol->RandomInitialization();
-    //jpol->ZeroInitialization();
+    JointPolicyPureVector best(*this);
     
     if(DEBUG_DPJESP) {cout << "joint policy randomly initialized to:";
-        jpol->Print();}
+        jpol.Print();}
     
     int stop = 0;
     size_t nr_non_improving_agents = 0;
-    while(nr_non_improving_agents < GetReferred()->GetNrAgents() -1
+    size_t nrAgents = GetNrAgents();
+    while(nr_non_improving_agents < nrAgents - 1
             && stop++ < 1000) 
     {
-        int agentI = GetNextAgentIndex();
-        double v = DynamicProgrammingBestResponse(jpol, agentI);
+        double v = DynamicProgrammingBestResponse(&jpol, agentI);
         if(v > v_best + 1e-9)
         {  
-            (*best) = (*jpol);
+            best = jpol;
             if(DEBUG_DPJESP)
-                {cout << ">>>Plan: new best policy:"<<endl; best->Print();}
+                {cout << ">>>Plan: new best policy:"<<endl; best.Print();}
             v_best = v;
             nr_non_improving_agents = 0;
         }        
         else
             nr_non_improving_agents++;
+        //a local agent counter instead of GetNextAgentIndex(), which
+        //modifies the planning unit
+        agentI = (agentI + 1) % nrAgents;
     }
-    _m_foundPolicy = *best;
-    _m_expectedRewardFoundPolicy=v_best;
-    
-
-    if(DEBUG_DPJESP){ 
-        cout << "Exhaustive JESP  - resulting policy:"<<endl;
-        cout << "------------------------------------"<<endl;
-        best->Print();
-    }
-    delete jpol;
-    delete best;
+    jpol = best;
+    return(v_best);
 }
 
 double JESPDynamicProgrammingPlanner::DynamicProgrammingBestResponse(
@@ -138,15 +186,41 @@ double JESPDynamicProgrammingPlanner::DynamicProgrammingBestResponse(
     IndividualBeliefJESP B0( agentI, 0, *this );
     B0.Set( *GetProblem()->GetISD() );
     vector<Index> newpol (GetNrActionObservationHistories(agentI), 0);
-    double v0 = DPBestResponseRecursively(agentI, 0, B0, 0, jpol, newpol);
+    //the beliefs for the later stages are allocated once, and reused for
+    //all action-observation histories
+    vector<IndividualBeliefJESP*> beliefs;
+    AllocateBeliefs(agentI, 1, beliefs);
+    vector<Index> aohRep(newpol.size());
+    for(Index aohI=0; aohI < aohRep.size(); aohI++)
+        aohRep[aohI] = aohI;
+    vector<BeliefValueMap> memo(_m_useClustering ? GetHorizon() : 0);
+    double v0 = DPBestResponseRecursively(agentI, 0, B0, 0, jpol, newpol,
+                                          beliefs, aohRep, memo);
+    DeleteBeliefs(beliefs);
 #if DEBUG_DPBR
 //    {   cout << "Best response V="<<v0<<endl;}
 //    { cout << "policy="; jpol->Print();}
 #endif    
-    ConstructPolicyRecursively(agentI, 0, 0, 0, jpol, newpol);
+    ConstructPolicyRecursively(agentI, 0, 0, 0, jpol, newpol, aohRep);
     return(v0);
 }
 
+void JESPDynamicProgrammingPlanner::AllocateBeliefs(Index agentI,
+    Index firstStage, vector<IndividualBeliefJESP*>& beliefs) const
+{
+    beliefs.assign(GetHorizon(), 0);
+    for(Index t=firstStage; t < GetHorizon(); t++)
+        beliefs[t] = new IndividualBeliefJESP(agentI, t, *this);
+}
+
+void JESPDynamicProgrammingPlanner::DeleteBeliefs(
+    vector<IndividualBeliefJESP*>& beliefs) const
+{
+    for(Index t=0; t < beliefs.size(); t++)
+        delete beliefs[t];
+    beliefs.clear();
+}
+
 double JESPDynamicProgrammingPlanner::DPBestResponseRecursively
     (
      const Index agentI, //the agent we are computing the best response for
@@ -154,7 +228,10 @@ double JESPDynamicProgrammingPlanner::DPBestResponseRecursively
      const IndividualBeliefJESP& B,//for which we compute the value+action
      const Index stage, //the stage of B
      JointPolicyPureVector* jpol,//the joint policy
-     vector<Index>& new_pol
+     vector<Index>& new_pol,
+     vector<IndividualBeliefJESP*>& beliefs,
+     vector<Index>& aohRep,
+     vector<BeliefValueMap>& memo
     )
 {
 
@@ -166,14 +243,43 @@ string tabss = tabsss.str();
 cout << tabss<<">>DPBestResponseRecursively(ag="<<agentI<<", aoh="<<aohI<<", B, stage="<<stage<< ", jpol) called, with " << endl <<tabss<<"B="<<endl;
 B.Print();
 #endif    
-    vector<Index> otherAgentIndices;
-    for(Index agI=0; agI < GetNrAgents(); agI++)
-        if(agI != agentI)
-            otherAgentIndices.push_back(agI);
+    //look up B, except at the first stage (which has a single history)
+    //and the last (for which the lookup costs as much as the computation)
+    vector<double> key;
+    if(!memo.empty() && stage > 0 && stage < GetHorizon() - 1)
+    {
+        key.resize(B.Size());
+        for(Index eI=0; eI < B.Size(); eI++)
+        {
+            double p = B.Get(eI);
+            if(p != p) //histories that cannot occur have no belief
+            {
+                key.clear();
+                break;
+            }
+            key[eI] = floor(p / JESP_CLUSTER_PRECISION + 0.5);
+        }
+    }
+    if(!key.empty())
+    {
+        bool found = false;
+        double v = 0;
+#pragma omp critical(JESPBeliefMemo)
+        {
+            BeliefValueMap::const_iterator it = memo[stage].find(key);
+            if(it != memo[stage].end())
+            {
+                v = it->second.first;
+                aohRep.at(aohI) = it->second.second;
+                found = true;
+            }
+        }
+        if(found)
+            return(v);
+    }
 
     size_t nrA = GetReferred()->GetNrActions(agentI);
     size_t nrO = GetReferred()->GetNrObservations(agentI);
-    size_t nrAgents = GetNrAgents();
     double v_max = -DBL_MAX; //higest expected value
     Index a_br = 0; //and the corresponding best-response action
     for(Index actionI=0; actionI < nrA; actionI++)//compute value of this action
@@ -183,22 +289,8 @@ B.Print();
         double Rba = 0.0;
         for(Index eI=0; eI < B.Size(); eI++) //eI is an index over e=<s,oHistJ>
         {
-//-> check if this should be put in a function ? 
-//( duplicated in IndividualBeliefJESP.Update() )
             Index sI = B.GetStateIndex(eI);
-            vector<Index> oHistI_others = B.GetOthersObservationHistIndex(eI);
-            vector<Index> actions(nrAgents);
-            actions.at(agentI) = actionI;
-            for(Index j=0; j < otherAgentIndices.size(); j++)
-            {
-                Index agJ = otherAgentIndices[j];
-                Index oHistJ = oHistI_others[j];//not agJ!!!
-                Index actJ = jpol->GetActionIndex(agJ, oHistJ);
-                actions.at(agJ) = actJ;
-
-            }
-            Index jaI = IndividualToJointActionIndices(actions);
-// <-             
+            Index jaI = B.GetJointActionIndex(eI, actionI, jpol);
             Rba += B.Get(eI) * GetReward(sI, jaI);
         }
 
@@ -207,16 +299,30 @@ B.Print();
         if(stage < GetHorizon() - 1)
         {
             double check_p = 0.0;
-            for(Index observI=0; observI < nrO; observI++)
+            //the sub-trees for different observations write disjoint parts
+            //of new_pol, so they can be computed in parallel
+            bool parallel = (stage == 0 &&
+                             nrO >= JESP_MIN_NR_OBSERVATIONS_PARALLEL);
+            int nrOint = static_cast<int>(nrO);
+#pragma omp parallel for reduction(+:F,check_p) if(parallel)
+            for(int observI=0; observI < nrOint; observI++)
             {
-                IndividualBeliefJESP Bao(agentI, stage+1, *this);
+                //in parallel, every observation needs its own beliefs
+                vector<IndividualBeliefJESP*> privateBeliefs;
+                if(parallel)
+                    AllocateBeliefs(agentI, stage+1, privateBeliefs);
+                vector<IndividualBeliefJESP*>& bs =
+                    parallel ? privateBeliefs : beliefs;
+
+                IndividualBeliefJESP& Bao = *bs[stage+1];
                 double Po_ba = Bao.Update(B, actionI, observI, jpol);
                 Index next_aohI = 
                     GetSuccessorAOHI(agentI, aohI, actionI, observI);
                 double F_ao = DPBestResponseRecursively(agentI, next_aohI,
-                        Bao, stage+1, jpol, new_pol);
+                        Bao, stage+1, jpol, new_pol, bs, aohRep, memo);
                 F += Po_ba * F_ao;
                 check_p += Po_ba;
+                DeleteBeliefs(privateBeliefs);
             }
             if( abs(check_p - 1) > 1e7)
                 throw E("Po_ba not summing to 1");
@@ -243,6 +349,11 @@ cout << tabss<<"Selected actionI="<<a_br<<" with Q(b,a)="
     //we are overwriting the best action taken from a previous. one
     //jpol->SetAction(agentI, aohI, a_br);
     new_pol.at(aohI) = a_br;
+    if(!key.empty())
+    {
+#pragma omp critical(JESPBeliefMemo)
+        memo[stage].insert(make_pair(key, make_pair(v_max, aohI)));
+    }
     return v_max;
 }
 
@@ -254,7 +365,8 @@ void JESPDynamicProgrammingPlanner::ConstructPolicyRecursively
      const Index ohI,    //the observation history of agentI
      const Index stage, //the stage of B
      JointPolicyPureVector* jpol,//the joint policy
-     vector<Index>& new_pol
+     vector<Index>& new_pol,
+     const vector<Index>& aohRep
     )
 {
 #if DEBUG_DPBR    
@@ -263,8 +375,10 @@ for(Index tab=0; tab < stage; tab++)
     tabsss << "\t";
 string tabss = tabsss.str();
 #endif    
-    //the action that is best at this aohI
-    Index best_a = new_pol[aohI];
+    //the action that is best at this aohI, which is found at the AOH it
+    //was clustered with
+    Index repI = aohRep[aohI];
+    Index best_a = new_pol[repI];
     jpol->SetAction(agentI, ohI, best_a);
 
     size_t nrO = GetReferred()->GetNrObservations(agentI);
@@ -272,10 +386,10 @@ string tabss = tabsss.str();
     {
         for(Index oI=0; oI < nrO; oI++)
         {
-            Index next_aohI = GetSuccessorAOHI(agentI, aohI, best_a, oI);
+            Index next_aohI = GetSuccessorAOHI(agentI, repI, best_a, oI);
             Index next_ohI = GetSuccessorOHI(agentI, ohI, oI);
             ConstructPolicyRecursively(agentI, next_aohI, next_ohI, stage+1,
-                    jpol, new_pol);
+                    jpol, new_pol, aohRep);
         }
     }
 #if DEBUG_DPBR
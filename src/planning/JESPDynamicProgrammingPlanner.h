@@ -31,6 +31,7 @@
 
 /* the include directives */
 #include <iostream>
+#include <map>
 #include "Globals.h"
 #include "PlanningUnitDecPOMDPDiscrete.h"
 //#include "ValueFunctionDecPOMDPDiscrete.h"
@@ -52,9 +53,22 @@ class JESPDynamicProgrammingPlanner : public PlanningUnitDecPOMDPDiscrete
         JointPolicyPureVector _m_foundPolicy;
         //the expected reward of the best found policy
         double _m_expectedRewardFoundPolicy;
+        //the number of random restarts performed by Plan()
+        size_t _m_nrRestarts;
+        //whether histories with equal beliefs share their best response
+        bool _m_useClustering;
         //intermediate result from ExhaustiveBestResponse
         //JointPolicyPureVector _m_exhBRBestPol;
     protected:
+        ///Maps a (quantized) belief to its value and the first AOH with it.
+        typedef std::map<std::vector<double>, std::pair<double, Index> >
+            BeliefValueMap;
+
+        ///Runs JESP starting from jpol, until no agent improves.
+        /** Best responses are computed for agentI, agentI+1, ... in turn.
+         * On return jpol contains the best policy found, and its value is
+         * returned. */
+        double LocalSearch(JointPolicyPureVector& jpol, Index agentI);
         ///Computes a best response for agentI recursively
         /**
          *\li agentI  -the agent we are computing the best response for
@@ -64,6 +78,16 @@ class JESPDynamicProgrammingPlanner : public PlanningUnitDecPOMDPDiscrete
          *\li jpol    -the joint policy
          *\li new_pol -vector that will contain the best action for each AOH for
          *             agent i
+         *\li beliefs -a belief for each stage after \a stage, which are
+         *             overwritten (so no beliefs are allocated per AOH)
+         *\li aohRep  -for each AOH, the AOH whose sub-tree of new_pol it
+         *             uses (itself, unless it is clustered)
+         *\li memo    -for each stage, the beliefs solved so far (empty
+         *             if histories are not clustered)
+         *
+         * When clustering, an AOH whose belief B equals that of an AOH
+         * solved before has the same best-response sub-tree, so it is
+         * not recursed into but mapped to that AOH in aohRep.
          */
         double DPBestResponseRecursively (
                 const Index agentI, 
@@ -71,15 +95,23 @@ class JESPDynamicProgrammingPlanner : public PlanningUnitDecPOMDPDiscrete
                 const IndividualBeliefJESP& B, 
                 const Index stage, 
                 JointPolicyPureVector* jpol,
-                std::vector<Index>& new_pol
+                std::vector<Index>& new_pol,
+                std::vector<IndividualBeliefJESP*>& beliefs,
+                std::vector<Index>& aohRep,
+                std::vector<BeliefValueMap>& memo
                 );
+        ///Allocates beliefs for agentI for stage firstStage and later.
+        void AllocateBeliefs(Index agentI, Index firstStage,
+                             std::vector<IndividualBeliefJESP*>& beliefs) const;
+        void DeleteBeliefs(std::vector<IndividualBeliefJESP*>& beliefs) const;
         void ConstructPolicyRecursively  (
              const Index agentI, //the agent we are computing for
              const Index aohI,    //the action-observation history of agentI
              const Index ohI,    //the observation history of agentI
              const Index stage, //the stage of B
              JointPolicyPureVector* jpol,//the joint policy
-             std::vector<Index>& new_pol
+             std::vector<Index>& new_pol,
+             const std::vector<Index>& aohRep
             );
     public:
         
@@ -98,6 +130,16 @@ class JESPDynamicProgrammingPlanner : public PlanningUnitDecPOMDPDiscrete
         /**The methods that performs the planning according to the Exhaustive
          * JESP algorithm. */
         void Plan();
+        /**Sets the number of random restarts performed by Plan(). The
+         * restarts run in parallel when compiled with OpenMP, and the
+         * best policy over all restarts is kept. Default is 1. */
+        void SetNrRestarts(size_t nrRestarts);
+        /**Sets whether action-observation histories of the best-responding
+         * agent that induce the same belief (over states and observation
+         * histories of the others) are clustered, such that their
+         * best response is computed only once. Default is false. */
+        void SetUseClustering(bool useClustering)
+            { _m_useClustering = useClustering; }
         double DynamicProgrammingBestResponse(JointPolicyPureVector* jpol, 
                 Index agentI);
 
@@ -110,6 +152,10 @@ class JESPDynamicProgrammingPlanner : public PlanningUnitDecPOMDPDiscrete
             { return(&_m_foundPolicy); }
         double GetExpectedReward(void) const
             { return(_m_expectedRewardFoundPolicy); }
+        size_t GetNrRestarts() const
+            { return(_m_nrRestarts); }
+        bool GetUseClustering() const
+            { return(_m_useClustering); }
 
 };
 
@@ -39,7 +39,8 @@ JESPExhaustivePlanner::JESPExhaustivePlanner(
     DecPOMDPDiscreteInterface* p
     ) :
     PlanningUnitDecPOMDPDiscrete(params, horizon, p),
-    _m_foundPolicy(*this)
+    _m_foundPolicy(*this),
+    _m_nrRestarts(1)
     //,_m_exhBRBestPol(*this)
 {
 }
@@ -49,11 +50,19 @@ JESPExhaustivePlanner::JESPExhaustivePlanner(
     DecPOMDPDiscreteInterface* p
     ) :
     PlanningUnitDecPOMDPDiscrete(horizon, p),
-    _m_foundPolicy(*this)
+    _m_foundPolicy(*this),
+    _m_nrRestarts(1)
     //,_m_exhBRBestPol(*this)
 {
 }
 
+void JESPExhaustivePlanner::SetNrRestarts(size_t nrRestarts)
+{
+    if(nrRestarts == 0)
+        throw E("JESPExhaustivePlanner: nrRestarts should be >= 1");
+    _m_nrRestarts = nrRestarts;
+}
+
 void JESPExhaustivePlanner::Plan()
 {
     if(DEBUG_EXJESP){ 
@@ -61,41 +70,68 @@ void JESPExhaustivePlanner::Plan()
         cout << "Exhaustive JESP  - Plan() started"<<endl;
         cout << "---------------------------------"<<endl;
     }
+    //RandomInitialization() uses the (global) rand(), so initialize all
+    //restarts before the parallel section
+    vector<JointPolicyPureVector*> jpols(_m_nrRestarts);
+    vector<double> values(_m_nrRestarts, -DBL_MAX);
+    for(Index r=0; r < _m_nrRestarts; r++)
+    {
+        jpols[r] = new JointPolicyPureVector(*this);
+        jpols[r]->RandomInitialization();
+    }
+
+    int nrRestarts = static_cast<int>(_m_nrRestarts);
+#pragma omp parallel for schedule(dynamic) if(nrRestarts > 1)
+    for(int r=0; r < nrRestarts; r++)
+        values[r] = LocalSearch(*jpols[r], r % GetNrAgents());
+
+    Index best = 0;
+    for(Index r=1; r < _m_nrRestarts; r++)
+        if(values[r] > values[best])
+            best = r;
+    _m_foundPolicy = *jpols[best];
+    _m_expectedRewardFoundPolicy = values[best];
+
+    if(DEBUG_EXJESP){ 
+        cout << "Exhaustive JESP  - resulting policy:"<<endl;
+        cout << "------------------------------------"<<endl;
+        _m_foundPolicy.Print();
+    }
+    for(Index r=0; r < _m_nrRestarts; r++)
+        delete jpols[r];
+}
+
+double JESPExhaustivePlanner::LocalSearch(JointPolicyPureVector& jpol,
+                                          Index agentI)
+{
     double v_best = -DBL_MAX;
-    JointPolicyPureVector* jpol = new JointPolicyPureVector(*this);
-    JointPolicyPureVector* best = new JointPolicyPureVector(*this);
-    jpol->RandomInitialization();
+    JointPolicyPureVector best(*this);
     
     if(DEBUG_EXJESP) {cout << "joint policy randomly initialized to:";
-        jpol->Print();}
+        jpol.Print();}
     
     int stop = 0;
     size_t nr_non_improving_agents = 0;
-    while(nr_non_improving_agents < GetReferred()->GetNrAgents()
+    size_t nrAgents = GetNrAgents();
+    while(nr_non_improving_agents < nrAgents
             && stop++ < 1000) 
     {
-        int agentI = GetNextAgentIndex();
-        double v = ExhaustiveBestResponse(jpol, agentI);
+        double v = ExhaustiveBestResponse(&jpol, agentI);
         if(v > v_best + 1e-9)
         {  
-            (*best) = (*jpol);
+            best = jpol;
             if(DEBUG_EXHBR)
-                {cout << "Plan: new best policy:"<<endl; best->Print();}
+                {cout << "Plan: new best policy:"<<endl; best.Print();}
             v_best = v;
             nr_non_improving_agents = 0;
         }        
         else
             nr_non_improving_agents++;
+        //not GetNextAgentIndex(), as restarts may run in parallel
+        agentI = (agentI + 1) % nrAgents;
     }
-    _m_foundPolicy = *best;
-    _m_expectedRewardFoundPolicy=v_best;
-    
-
-    if(DEBUG_EXJESP){ 
-        cout << "Exhaustive JESP  - resulting policy:"<<endl;
-        cout << "------------------------------------"<<endl;
-        best->Print();
-    }
+    jpol = best;
+    return(v_best);
 }
 
 double JESPExhaustivePlanner::ExhaustiveBestResponse(JointPolicyPureVector* 
@@ -47,9 +47,16 @@ class JESPExhaustivePlanner : public PlanningUnitDecPOMDPDiscrete
         JointPolicyPureVector _m_foundPolicy;
         //the expected reward of the best found policy
         double _m_expectedRewardFoundPolicy;
+        //the number of random restarts performed by Plan()
+        size_t _m_nrRestarts;
         //intermediate result from ExhaustiveBestResponse
         //JointPolicyPureVector _m_exhBRBestPol;
     protected:
+        ///Runs JESP starting from jpol, until no agent improves.
+        /** Best responses are computed for agentI, agentI+1, ... in turn.
+         * On return jpol contains the best policy found, and its value is
+         * returned. */
+        double LocalSearch(JointPolicyPureVector& jpol, Index agentI);
     
     public:
         
@@ -67,6 +74,10 @@ class JESPExhaustivePlanner : public PlanningUnitDecPOMDPDiscrete
         /**The methods that performs the planning according to the Exhaustive
          * JESP algorithm. */
         void Plan();
+        /**Sets the number of random restarts performed by Plan(). The
+         * restarts run in parallel when compiled with OpenMP, and the
+         * best policy over all restarts is kept. Default is 1. */
+        void SetNrRestarts(size_t nrRestarts);
         double ExhaustiveBestResponse(JointPolicyPureVector* jpol, int agentI);
 
         //get (data) functions:
@@ -78,6 +89,8 @@ class JESPExhaustivePlanner : public PlanningUnitDecPOMDPDiscrete
             { return(&_m_foundPolicy); }
         double GetExpectedReward(void) const
             { return(_m_expectedRewardFoundPolicy); }
+        size_t GetNrRestarts() const
+            { return(_m_nrRestarts); }
 
 };
 
@@ -0,0 +1,94 @@
+/**\file JointBeliefTracker.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "JointBeliefTracker.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+#include "JointBeliefInterface.h"
+
+using namespace std;
+
+JointBeliefTracker::JointBeliefTracker(const PlanningUnitDecPOMDPDiscrete &pu) :
+    _m_pu(&pu),
+    _m_jb(0)
+{
+    Reset();
+}
+
+JointBeliefTracker::JointBeliefTracker(const JointBeliefTracker& a) :
+    _m_pu(a._m_pu),
+    _m_t(a._m_t),
+    _m_jaI(a._m_jaI),
+    _m_joI(a._m_joI)
+{
+    _m_jb=_m_pu->GetNewJointBeliefInterface();
+    *_m_jb=*a._m_jb;
+}
+
+JointBeliefTracker::~JointBeliefTracker()
+{
+    delete _m_jb;
+}
+
+void JointBeliefTracker::Reset()
+{
+    delete _m_jb;
+    _m_jb=_m_pu->GetNewJointBeliefFromISD();
+    _m_t=0;
+    _m_jaI=INT_MAX;
+    _m_joI=INT_MAX;
+}
+
+const JointBeliefInterface&
+JointBeliefTracker::GetJointBelief(Index t, Index jaI, Index joI)
+{
+    if(t==0)
+    {
+        if(_m_t!=0)
+            Reset();
+    }
+    else if(t==_m_t)
+    {
+        if(jaI!=_m_jaI || joI!=_m_joI)
+            throw(E("JointBeliefTracker::GetJointBelief: different joint action or observation at the same stage, agents do not share observations"));
+    }
+    else if(t==_m_t+1)
+    {
+        _m_jb->Update(*_m_pu->GetReferred(),jaI,joI);
+        _m_t=t;
+        _m_jaI=jaI;
+        _m_joI=joI;
+    }
+    else
+    {
+        stringstream ss;
+        ss << "JointBeliefTracker::GetJointBelief: requested stage " << t
+           << " while tracking stage " << _m_t;
+        throw(E(ss));
+    }
+
+    return(*_m_jb);
+}
@@ -0,0 +1,91 @@
+/**\file JointBeliefTracker.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _JOINTBELIEFTRACKER_H_
+#define _JOINTBELIEFTRACKER_H_ 1
+
+/* the include directives */
+#include "Globals.h"
+
+class PlanningUnitDecPOMDPDiscrete;
+class JointBeliefInterface;
+
+/**\brief JointBeliefTracker keeps track of the joint belief during
+ * online execution, for agents that share their observations.
+ *
+ * All agents that have access to the same joint observations compute
+ * the same joint belief. Instead of each of them performing the same
+ * belief update every stage, they can share a JointBeliefTracker: the
+ * first agent that asks for the joint belief at a stage updates it,
+ * the others get the cached result.
+ */
+class JointBeliefTracker 
+{
+private:    
+    const PlanningUnitDecPOMDPDiscrete *_m_pu;
+
+    /// The joint belief at stage _m_t.
+    JointBeliefInterface *_m_jb;
+    /// The stage of _m_jb.
+    Index _m_t;
+    /// The joint action and observation that led to _m_jb.
+    Index _m_jaI, _m_joI;
+
+    void Reset();
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructor, the tracker starts at the initial state distribution.
+    JointBeliefTracker(const PlanningUnitDecPOMDPDiscrete &pu);
+    /// Copy constructor.
+    JointBeliefTracker(const JointBeliefTracker& a);
+    /// Destructor.
+    ~JointBeliefTracker();
+
+    /**\brief Returns the joint belief at stage \a t, after taking
+     * joint action \a jaI and receiving joint observation \a joI at
+     * stage t-1.
+     *
+     * At t=0 the joint belief is the ISD, and \a jaI and \a joI are
+     * ignored. Only the current stage and the next one can be
+     * requested, and requesting the current stage with a different
+     * joint action or observation throws an E (the agents do not
+     * share their observations). */
+    const JointBeliefInterface& GetJointBelief(Index t,
+                                               Index jaI=INT_MAX,
+                                               Index joI=INT_MAX);
+};
+
+
+#endif /* !_JOINTBELIEFTRACKER_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
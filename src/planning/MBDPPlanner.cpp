@@ -0,0 +1,631 @@
+/**\file MBDPPlanner.cpp
+ *
+ * Authors:
+ * Christopher Jackson <christopher.jackson@gmail.com>
+ *
+ * Copyright 2010 Institute for Artificial Intelligence, University of Georgia
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include "MBDPPlanner.h"
+#include "MDPValueIteration.h"
+#include "PolicyAutomaton.h"
+#include "JointBeliefInterface.h"
+#include <float.h>
+#include <limits.h>
+#include <cstdlib>
+#include <cmath>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+#define DEBUG_MBDP 0
+
+///The max. nr. of beliefs sampled per tree to find maxTrees distinct trees.
+#define MBDP_MAX_SAMPLES_PER_TREE 10
+
+///Decodes candidate k of a (partial) backup into the children of each agent.
+/**children[agI][oI] is the tree of the next stage that agI executes
+ * after observing oI. Only the observations in obsI[agI] are assigned
+ * a tree by k, the others get the tree of the first (most likely) one.
+ * The last agent changes fastest. */
+static void DecodeCandidate(LIndex k,
+                            const vector<size_t>& nrTrees,
+                            const vector<LIndex>& nrMaps,
+                            const vector<vector<Index> >& obsI,
+                            vector<vector<Index> >& children)
+{
+    for(Index agI=nrTrees.size(); agI > 0; agI--)
+    {
+        LIndex mapI = k % nrMaps[agI-1];
+        k /= nrMaps[agI-1];
+        const vector<Index>& o = obsI[agI-1];
+        vector<Index>& c = children[agI-1];
+        for(Index i=0; i < o.size(); i++)
+        {
+            c[o[i]] = mapI % nrTrees[agI-1];
+            mapI /= nrTrees[agI-1];
+        }
+        if(o.size() < c.size())
+        {
+            vector<bool> assigned(c.size(), false);
+            for(Index i=0; i < o.size(); i++)
+                assigned[o[i]] = true;
+            for(Index oI=0; oI < c.size(); oI++)
+                if(!assigned[oI])
+                    c[oI] = c[o[0]];
+        }
+    }
+}
+
+MBDPPlanner::MBDPPlanner(
+    const PlanningUnitMADPDiscreteParameters &params,
+    size_t horizon,
+    DecPOMDPDiscreteInterface* p,
+    size_t maxTrees,
+    double exploration
+    ) :
+    PlanningUnitDecPOMDPDiscrete(params, horizon, p),
+    _m_foundPolicy(0),
+    _m_expectedRewardFoundPolicy(0),
+    _m_maxObservations(0)
+{
+    SetMaxTrees(maxTrees);
+    SetExploration(exploration);
+}
+
+MBDPPlanner::MBDPPlanner(
+    int horizon,
+    DecPOMDPDiscreteInterface* p,
+    size_t maxTrees,
+    double exploration
+    ) :
+    PlanningUnitDecPOMDPDiscrete(horizon, p),
+    _m_foundPolicy(0),
+    _m_expectedRewardFoundPolicy(0),
+    _m_maxObservations(0)
+{
+    SetMaxTrees(maxTrees);
+    SetExploration(exploration);
+}
+
+MBDPPlanner::~MBDPPlanner()
+{
+    delete _m_foundPolicy;
+}
+
+void MBDPPlanner::SetMaxTrees(size_t maxTrees)
+{
+    if(maxTrees == 0)
+        throw E("MBDPPlanner: maxTrees should be >= 1");
+    _m_maxTrees = maxTrees;
+}
+
+void MBDPPlanner::SetExploration(double exploration)
+{
+    if(exploration < 0 || exploration > 1)
+        throw E("MBDPPlanner: exploration should be in [0,1]");
+    _m_exploration = exploration;
+}
+
+void MBDPPlanner::Plan()
+{
+    delete _m_foundPolicy;
+    _m_foundPolicy = 0;
+
+    size_t h = GetHorizon();
+    size_t nrAgents = GetNrAgents();
+    if(h == MAXHORIZON)
+        throw E("MBDPPlanner: only finite horizons are supported");
+
+    // the MDP heuristic used to sample beliefs
+    MDPValueIteration mdp(*this);
+    mdp.Plan();
+
+    _m_treeActions.assign(h, vector<vector<Index> >(nrAgents));
+    _m_treeSuccessors.assign(h, vector<vector<Index> >(nrAgents));
+
+    // the values of the joint trees of the next and the current stage
+    vector<vector<double> > Vnext, V;
+    vector<vector<double> > beliefs;
+    vector<vector<Index> > trees;
+    vector<vector<Index> > obsI;
+    for(Index t=h; t > 0; t--)
+    {
+        Index stage = t - 1;
+        // the observations that are assigned a tree in the backup
+        if(stage < h - 1)
+            SelectObservations(stage, mdp, obsI);
+
+        // keep the best candidate for each sampled belief, without
+        // duplicates. Beliefs often coincide (e.g., after a reset), so
+        // sample until every agent has maxTrees distinct trees, or the
+        // sampling budget is exhausted. At the first stage only the
+        // initial belief matters.
+        size_t nrSamples = (stage == 0) ? 1 :
+            _m_maxTrees * MBDP_MAX_SAMPLES_PER_TREE;
+        vector<map<vector<Index>, Index> > kept(nrAgents);
+        for(Index bI=0; bI < nrSamples; bI++)
+        {
+            bool full = true;
+            for(Index agI=0; agI < nrAgents; agI++)
+                if(kept[agI].size() < _m_maxTrees)
+                    full = false;
+            if(full)
+                break;
+
+            SampleBeliefs(stage, 1, mdp, beliefs);
+#if DEBUG_MBDP
+            double v =
+#endif
+            SelectBestCandidate(stage, beliefs[0], Vnext, obsI, trees);
+#if DEBUG_MBDP
+            cout << "MBDPPlanner stage " << stage << " belief " << bI
+                 << ": " << SoftPrintVector(beliefs[0]) << " value "
+                 << v << endl;
+#endif
+            for(Index agI=0; agI < nrAgents; agI++)
+            {
+                if(kept[agI].size() == _m_maxTrees ||
+                   kept[agI].find(trees[agI]) != kept[agI].end())
+                    continue;
+                kept[agI][trees[agI]] = _m_treeActions[stage][agI].size();
+                _m_treeActions[stage][agI].push_back(trees[agI][0]);
+                _m_treeSuccessors[stage][agI].insert(
+                    _m_treeSuccessors[stage][agI].end(),
+                    trees[agI].begin() + 1, trees[agI].end());
+            }
+        }
+
+        ComputeValues(stage, Vnext, V);
+        Vnext.swap(V);
+    }
+
+    // stage 0 has a single joint tree
+    JointBeliefInterface* b0 = GetNewJointBeliefFromISD();
+    _m_expectedRewardFoundPolicy = 0;
+    for(Index sI=0; sI < GetNrStates(); sI++)
+        _m_expectedRewardFoundPolicy += b0->Get(sI) * Vnext[0][sI];
+    delete b0;
+}
+
+void MBDPPlanner::SampleBeliefs(Index stage, size_t nrBeliefs,
+                                const MDPValueIteration& mdp,
+                                vector<vector<double> >& beliefs,
+                                vector<Index>* jaIs) const
+{
+    size_t nrJA = GetNrJointActions();
+    beliefs.clear();
+    if(jaIs)
+        jaIs->clear();
+    for(Index bI=0; bI < nrBeliefs; bI++)
+    {
+        bool random = (rand() / (RAND_MAX + 1.0)) < _m_exploration;
+        JointBeliefInterface* jb = GetNewJointBeliefFromISD();
+        Index sI = GetReferred()->SampleInitialState();
+        // also select the action at stage if requested
+        size_t nrSteps = jaIs ? stage + 1 : stage;
+        for(Index t=0; t < nrSteps; t++)
+        {
+            Index jaI = 0;
+            if(random)
+                jaI = rand() % nrJA;
+            else
+            {
+                double maxQ = -DBL_MAX;
+                for(Index a=0; a < nrJA; a++)
+                {
+                    double q = mdp.GetQ(t, sI, a);
+                    if(q > maxQ)
+                    {
+                        maxQ = q;
+                        jaI = a;
+                    }
+                }
+            }
+            if(t == stage)
+            {
+                jaIs->push_back(jaI);
+                break;
+            }
+            Index sucI = GetReferred()->SampleSuccessorState(sI, jaI);
+            Index joI = GetReferred()->SampleJointObservation(jaI, sucI);
+            jb->Update(*GetReferred(), jaI, joI);
+            sI = sucI;
+        }
+        beliefs.push_back(jb->Get());
+        delete jb;
+    }
+}
+
+void MBDPPlanner::SelectObservations(Index stage,
+                                     const MDPValueIteration& mdp,
+                                     vector<vector<Index> >& obsI) const
+{
+    size_t nrAgents = GetNrAgents();
+    obsI.assign(nrAgents, vector<Index>());
+    bool compress = false;
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        size_t nrO = GetNrObservations(agI);
+        for(Index oI=0; oI < nrO; oI++)
+            obsI[agI].push_back(oI);
+        if(_m_maxObservations > 0 && _m_maxObservations < nrO)
+            compress = true;
+    }
+    if(!compress)
+        return;
+
+    // the probability of each individual observation after stage,
+    // averaged over the belief portfolio
+    size_t nrS = GetNrStates();
+    size_t nrJO = GetNrJointObservations();
+    vector<vector<double> > beliefs;
+    vector<Index> jaIs;
+    SampleBeliefs(stage, _m_maxTrees * MBDP_MAX_SAMPLES_PER_TREE, mdp,
+                  beliefs, &jaIs);
+    vector<vector<double> > pObs(nrAgents);
+    for(Index agI=0; agI < nrAgents; agI++)
+        pObs[agI].resize(GetNrObservations(agI), 0.0);
+    for(Index bI=0; bI < beliefs.size(); bI++)
+    {
+        const vector<double>& b = beliefs[bI];
+        Index jaI = jaIs[bI];
+        for(Index sucI=0; sucI < nrS; sucI++)
+        {
+            double pSuc = 0;
+            for(Index sI=0; sI < nrS; sI++)
+                if(b[sI] > 0)
+                    pSuc += b[sI] * GetTransitionProbability(sI, jaI, sucI);
+            if(pSuc == 0)
+                continue;
+            for(Index joI=0; joI < nrJO; joI++)
+            {
+                double p = pSuc * GetObservationProbability(jaI, sucI, joI);
+                if(p == 0)
+                    continue;
+                const vector<Index>& oIs =
+                    GetReferred()->JointToIndividualObservationIndices(joI);
+                for(Index agI=0; agI < nrAgents; agI++)
+                    pObs[agI][oIs[agI]] += p;
+            }
+        }
+    }
+
+    // keep the most likely ones, in order of decreasing probability
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        if(_m_maxObservations >= obsI[agI].size())
+            continue;
+        vector<pair<double, Index> > sorted;
+        for(Index oI=0; oI < pObs[agI].size(); oI++)
+            sorted.push_back(make_pair(-pObs[agI][oI], oI));
+        stable_sort(sorted.begin(), sorted.end());
+        obsI[agI].clear();
+        for(Index i=0; i < _m_maxObservations; i++)
+            obsI[agI].push_back(sorted[i].second);
+#if DEBUG_MBDP
+        cout << "MBDPPlanner stage " << stage << " agent " << agI
+             << " observations " << SoftPrintVector(obsI[agI]) << endl;
+#endif
+    }
+}
+
+Index MBDPPlanner::GetJointTreeIndex(const vector<size_t>& nrTrees,
+                                     const vector<Index>& treeIs)
+{
+    Index jtI = 0;
+    for(Index agI=0; agI < nrTrees.size(); agI++)
+        jtI = jtI * nrTrees[agI] + treeIs[agI];
+    return(jtI);
+}
+
+double MBDPPlanner::SelectBestCandidate(Index stage,
+                                        const vector<double>& b,
+                                        const vector<vector<double> >& V,
+                                        const vector<vector<Index> >& obsI,
+                                        vector<vector<Index> >& trees) const
+{
+    size_t nrAgents = GetNrAgents();
+    size_t nrS = GetNrStates();
+    size_t nrJA = GetNrJointActions();
+    double gamma = GetDiscount();
+
+    double bestV = -DBL_MAX;
+    Index bestJA = 0;
+
+    if(stage == GetHorizon() - 1)
+    {
+        // the trees of the last stage are single actions
+        for(Index jaI=0; jaI < nrJA; jaI++)
+        {
+            double v = 0;
+            for(Index sI=0; sI < nrS; sI++)
+                v += b[sI] * GetReward(sI, jaI);
+            if(v > bestV)
+            {
+                bestV = v;
+                bestJA = jaI;
+            }
+        }
+        vector<Index> actions =
+            GetReferred()->JointToIndividualActionIndices(bestJA);
+        trees.assign(nrAgents, vector<Index>());
+        for(Index agI=0; agI < nrAgents; agI++)
+            trees[agI].push_back(actions[agI]);
+        return(bestV);
+    }
+
+    size_t nrJO = GetNrJointObservations();
+    size_t nrC = V.size();
+    vector<size_t> nrTrees(nrAgents);
+    vector<LIndex> nrMaps(nrAgents);
+    double nrCandidates = 1;
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        nrTrees[agI] = _m_treeActions[stage+1][agI].size();
+        nrMaps[agI] = 1;
+        for(Index i=0; i < obsI[agI].size(); i++)
+            nrMaps[agI] *= nrTrees[agI];
+        nrCandidates *= pow(static_cast<double>(nrTrees[agI]),
+                            static_cast<double>(obsI[agI].size()));
+    }
+    if(nrCandidates > INT_MAX)
+        throw E("MBDPPlanner: too many candidate trees per joint action, "
+                "decrease maxTrees or maxObservations");
+    int nrK = static_cast<int>(nrCandidates);
+
+    vector<vector<Index> > obs(nrJO);
+    for(Index joI=0; joI < nrJO; joI++)
+        obs[joI] = GetReferred()->JointToIndividualObservationIndices(joI);
+
+    LIndex bestK = 0;
+    // X[joI*nrC+c]: the probability of joI times the expected value of
+    // continuing with joint tree c
+    vector<double> X(nrJO * nrC);
+    for(Index jaI=0; jaI < nrJA; jaI++)
+    {
+        double bR = 0;
+        for(Index sI=0; sI < nrS; sI++)
+            bR += b[sI] * GetReward(sI, jaI);
+
+        fill(X.begin(), X.end(), 0.0);
+        for(Index sucI=0; sucI < nrS; sucI++)
+        {
+            double pSuc = 0;
+            for(Index sI=0; sI < nrS; sI++)
+                if(b[sI] > 0)
+                    pSuc += b[sI] * GetTransitionProbability(sI, jaI, sucI);
+            if(pSuc == 0)
+                continue;
+            for(Index joI=0; joI < nrJO; joI++)
+            {
+                double w = pSuc * GetObservationProbability(jaI, sucI, joI);
+                if(w == 0)
+                    continue;
+                for(Index c=0; c < nrC; c++)
+                    X[joI*nrC+c] += w * V[c][sucI];
+            }
+        }
+
+        // evaluate all assignments of next-stage trees to observations
+        double jaBestV = -DBL_MAX;
+        LIndex jaBestK = 0;
+#pragma omp parallel
+        {
+            double threadBestV = -DBL_MAX;
+            LIndex threadBestK = 0;
+            vector<vector<Index> > children(nrAgents);
+            for(Index agI=0; agI < nrAgents; agI++)
+                children[agI].resize(GetNrObservations(agI));
+            vector<Index> treeIs(nrAgents);
+#pragma omp for
+            for(int k=0; k < nrK; k++)
+            {
+                DecodeCandidate(k, nrTrees, nrMaps, obsI, children);
+                double f = 0;
+                for(Index joI=0; joI < nrJO; joI++)
+                {
+                    for(Index agI=0; agI < nrAgents; agI++)
+                        treeIs[agI] = children[agI][obs[joI][agI]];
+                    f += X[joI*nrC + GetJointTreeIndex(nrTrees, treeIs)];
+                }
+                if(f > threadBestV)
+                {
+                    threadBestV = f;
+                    threadBestK = k;
+                }
+            }
+#pragma omp critical(MBDPSelectBestCandidate)
+            {
+                // ties are broken in favor of the lowest candidate, so
+                // the result does not depend on the nr. of threads
+                if(threadBestV > jaBestV ||
+                   (threadBestV == jaBestV && threadBestK < jaBestK))
+                {
+                    jaBestV = threadBestV;
+                    jaBestK = threadBestK;
+                }
+            }
+        }
+
+        double v = bR + gamma * jaBestV;
+        if(v > bestV)
+        {
+            bestV = v;
+            bestJA = jaI;
+            bestK = jaBestK;
+        }
+    }
+
+    vector<vector<Index> > children(nrAgents);
+    for(Index agI=0; agI < nrAgents; agI++)
+        children[agI].resize(GetNrObservations(agI));
+    DecodeCandidate(bestK, nrTrees, nrMaps, obsI, children);
+    vector<Index> actions =
+        GetReferred()->JointToIndividualActionIndices(bestJA);
+    trees.assign(nrAgents, vector<Index>());
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        trees[agI].push_back(actions[agI]);
+        trees[agI].insert(trees[agI].end(),
+                          children[agI].begin(), children[agI].end());
+    }
+    return(bestV);
+}
+
+void MBDPPlanner::ComputeValues(Index stage,
+                                const vector<vector<double> >& Vnext,
+                                vector<vector<double> >& V) const
+{
+    size_t nrAgents = GetNrAgents();
+    size_t nrS = GetNrStates();
+    size_t nrJO = GetNrJointObservations();
+    double gamma = GetDiscount();
+    bool last = (stage == GetHorizon() - 1);
+
+    vector<size_t> nrTrees(nrAgents), nrTreesNext(nrAgents);
+    size_t nrC = 1;
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        nrTrees[agI] = _m_treeActions[stage][agI].size();
+        nrC *= nrTrees[agI];
+        if(!last)
+            nrTreesNext[agI] = _m_treeActions[stage+1][agI].size();
+    }
+
+    vector<vector<Index> > obs(nrJO);
+    for(Index joI=0; joI < nrJO; joI++)
+        obs[joI] = GetReferred()->JointToIndividualObservationIndices(joI);
+
+    V.assign(nrC, vector<double>(nrS, 0.0));
+#pragma omp parallel for
+    for(int c=0; c < static_cast<int>(nrC); c++)
+    {
+        // the tree and action of each agent, the last agent changes fastest
+        vector<Index> treeIs(nrAgents), actions(nrAgents);
+        Index rest = c;
+        for(Index agI=nrAgents; agI > 0; agI--)
+        {
+            treeIs[agI-1] = rest % nrTrees[agI-1];
+            rest /= nrTrees[agI-1];
+            actions[agI-1] = _m_treeActions[stage][agI-1][treeIs[agI-1]];
+        }
+        Index jaI = GetReferred()->IndividualToJointActionIndices(actions);
+
+        // the joint tree of the next stage after each joint observation
+        vector<Index> nextC(last ? 0 : nrJO);
+        vector<Index> next(nrAgents);
+        for(Index joI=0; joI < nextC.size(); joI++)
+        {
+            for(Index agI=0; agI < nrAgents; agI++)
+                next[agI] = _m_treeSuccessors[stage][agI]
+                    [treeIs[agI] * GetNrObservations(agI) + obs[joI][agI]];
+            nextC[joI] = GetJointTreeIndex(nrTreesNext, next);
+        }
+
+        for(Index sI=0; sI < nrS; sI++)
+        {
+            double f = 0;
+            if(!last)
+                for(Index sucI=0; sucI < nrS; sucI++)
+                {
+                    double pT = GetTransitionProbability(sI, jaI, sucI);
+                    if(pT == 0)
+                        continue;
+                    for(Index joI=0; joI < nrJO; joI++)
+                        f += pT * GetObservationProbability(jaI, sucI, joI) *
+                            Vnext[nextC[joI]][sucI];
+                }
+            V[c][sI] = GetReward(sI, jaI) + gamma * f;
+        }
+    }
+}
+
+PolicyAutomaton MBDPPlanner::GetPolicyAutomaton() const
+{
+    size_t h = _m_treeActions.size();
+    size_t nrAgents = GetNrAgents();
+    if(h == 0)
+        throw E("MBDPPlanner::GetPolicyAutomaton: call Plan() first");
+
+    vector<vector<Index> > actions(nrAgents), successors(nrAgents);
+    for(Index agI=0; agI < nrAgents; agI++)
+    {
+        size_t nrO = GetNrObservations(agI);
+        // the node of the first tree of each stage
+        vector<Index> offset(h+1, 0);
+        for(Index t=0; t < h; t++)
+            offset[t+1] = offset[t] + _m_treeActions[t][agI].size();
+
+        for(Index t=0; t < h; t++)
+        {
+            const vector<Index>& a = _m_treeActions[t][agI];
+            actions[agI].insert(actions[agI].end(), a.begin(), a.end());
+            for(Index treeI=0; treeI < a.size(); treeI++)
+                for(Index oI=0; oI < nrO; oI++)
+                    // after the last stage the policy is not defined,
+                    // restart at the root
+                    successors[agI].push_back(t+1 < h ?
+                        offset[t+1] + _m_treeSuccessors[t][agI][treeI*nrO+oI]
+                        : 0);
+        }
+    }
+    return(PolicyAutomaton(*this, actions, successors));
+}
+
+JointPolicyPureVector* MBDPPlanner::GetJointPolicyPureVector()
+{
+    if(_m_foundPolicy != 0)
+        return(_m_foundPolicy);
+    if(_m_treeActions.empty())
+        throw E("MBDPPlanner::GetJointPolicyPureVector: call Plan() first");
+
+    _m_foundPolicy = new JointPolicyPureVector(*this);
+    size_t h = GetHorizon();
+    for(Index agI=0; agI < GetNrAgents(); agI++)
+    {
+        size_t nrO = GetNrObservations(agI);
+        // the tree that is executed at each observation history of a stage
+        vector<Index> ohIs(1, 0), treeIs(1, 0);
+        for(Index t=0; t < h; t++)
+        {
+            vector<Index> nextOhIs, nextTreeIs;
+            for(Index i=0; i < ohIs.size(); i++)
+            {
+                _m_foundPolicy->SetAction(agI, ohIs[i],
+                                          _m_treeActions[t][agI][treeIs[i]]);
+                if(t+1 == h)
+                    continue;
+                for(Index oI=0; oI < nrO; oI++)
+                {
+                    nextOhIs.push_back(GetSuccessorOHI(agI, ohIs[i], oI));
+                    nextTreeIs.push_back(
+                        _m_treeSuccessors[t][agI][treeIs[i]*nrO+oI]);
+                }
+            }
+            ohIs.swap(nextOhIs);
+            treeIs.swap(nextTreeIs);
+        }
+    }
+    return(_m_foundPolicy);
+}
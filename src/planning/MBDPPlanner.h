@@ -0,0 +1,180 @@
+/**\file MBDPPlanner.h
+ *
+ * Authors:
+ * Christopher Jackson <christopher.jackson@gmail.com>
+ *
+ * Copyright 2010 Institute for Artificial Intelligence, University of Georgia
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _MBDPPLANNER_H_
+#define _MBDPPLANNER_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include <vector>
+#include "Globals.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+#include "JointPolicyPureVector.h"
+
+class JointPolicy;
+class MDPValueIteration;
+class PolicyAutomaton;
+
+/// MBDPPlanner plans with the Memory-Bounded Dynamic Programming algorithm
+/** It has been presented in refMBDP (see DOC-References.h).
+ *
+ * Policy trees are constructed bottom-up, from the last stage to the
+ * first. At each stage the trees of the next stage are backed up
+ * exhaustively (all actions combined with all assignments of next-stage
+ * trees to observations), and for each sampled belief the joint tree
+ * with the highest value is kept, until maxTrees distinct trees per
+ * agent are found. The beliefs are sampled top-down from a portfolio
+ * of heuristics: the MDP policy, or (with probability exploration) a
+ * random policy. Candidate trees are evaluated in parallel when
+ * compiled with OpenMP.
+ *
+ * The nr. of candidates per agent is |A|·maxTrees^|O|. When
+ * maxObservations is set (refIMBDP), only that many observations
+ * per agent, the most likely ones after the sampled beliefs, are
+ * assigned a tree in the backup; all other observations get the
+ * tree of the most likely one. The nr. of candidates per agent is then
+ * |A|·maxTrees^maxObservations.
+ *
+ * At most maxTrees trees per agent are kept per stage, so memory is
+ * linear in the horizon. The result is therefore best accessed as a
+ * PolicyAutomaton (see GetPolicyAutomaton()), which is as compact;
+ * GetJointPolicyPureVector() enumerates all observation histories and
+ * is only feasible for short horizons.
+ */
+class MBDPPlanner : public PlanningUnitDecPOMDPDiscrete
+{
+    private:    
+        //the best found policy, constructed on demand from the trees
+        JointPolicyPureVector* _m_foundPolicy;
+        //the expected reward of the best found policy
+        double _m_expectedRewardFoundPolicy;
+        // the max number of trees kept in memory after a fullBackup
+        size_t _m_maxTrees;
+        // the probability that a belief is sampled with the random
+        // heuristic instead of the MDP heuristic
+        double _m_exploration;
+        // the max. nr. of observations per agent that are assigned a tree
+        // in a backup (0 for all)
+        size_t _m_maxObservations;
+        // for each stage, agent and kept tree: its action
+        std::vector<std::vector<std::vector<Index> > > _m_treeActions;
+        // for each stage (but the last), agent and kept tree: the tree
+        // of the next stage for each observation oI (at treeI*nrO+oI)
+        std::vector<std::vector<std::vector<Index> > > _m_treeSuccessors;
+
+    protected:
+        ///Samples nrBeliefs beliefs over states for stage.
+        /**Each belief results from executing a heuristic from the
+         * initial state distribution for stage steps: the MDP policy
+         * mdp, or with probability _m_exploration random joint
+         * actions. States and observations are sampled from the
+         * problem, and the belief is updated accordingly. If jaIs is
+         * given, it receives the joint action the heuristic selects at
+         * stage for each belief. */
+        void SampleBeliefs(Index stage, size_t nrBeliefs,
+                           const MDPValueIteration& mdp,
+                           std::vector<std::vector<double> >& beliefs,
+                           std::vector<Index>* jaIs=0) const;
+        ///Selects the observations that are assigned a tree at stage.
+        /**obsI[agI] contains the _m_maxObservations most likely
+         * observations of agI after stage, in order of decreasing
+         * probability, estimated from sampled beliefs. Without a bound
+         * they are all observations, in order of index. */
+        void SelectObservations(Index stage, const MDPValueIteration& mdp,
+                                std::vector<std::vector<Index> >& obsI) const;
+        ///Returns the joint index of a tree for each agent.
+        static Index GetJointTreeIndex(const std::vector<size_t>& nrTrees,
+                                       const std::vector<Index>& treeIs);
+        ///Returns the best joint candidate tree of stage for belief b.
+        /**The candidates are the full backup of the trees of stage+1,
+         * which have values V (per joint tree and state), restricted
+         * to the observations obsI (see SelectObservations()). On return
+         * trees contains, for each agent, the action of the best joint
+         * candidate followed by its tree of stage+1 for each
+         * observation. Its value is returned. */
+        double SelectBestCandidate(Index stage,
+                                   const std::vector<double>& b,
+                                   const std::vector<std::vector<double> >& V,
+                                   const std::vector<std::vector<Index> >& obsI,
+                                   std::vector<std::vector<Index> >& trees)
+            const;
+        ///Computes the value (per state) of each joint tree of stage.
+        /**Vnext are the values of the joint trees of stage+1. */
+        void ComputeValues(Index stage,
+                           const std::vector<std::vector<double> >& Vnext,
+                           std::vector<std::vector<double> >& V) const;
+
+    public:
+        
+        // Constructor, destructor and copy assignment.
+        MBDPPlanner(
+            const PlanningUnitMADPDiscreteParameters &params,
+            size_t horizon, DecPOMDPDiscreteInterface* p,
+            size_t maxTrees=3, double exploration=0.5);
+        MBDPPlanner(int horizon,
+                    DecPOMDPDiscreteInterface* p,
+                    size_t maxTrees=3, double exploration=0.5);
+        ~MBDPPlanner();
+
+        //operators:
+
+        void Plan();
+        size_t GetMaxTrees() const { return(_m_maxTrees); }
+        void SetMaxTrees(size_t maxTrees);
+        double GetExploration() const { return(_m_exploration); }
+        void SetExploration(double exploration);
+        size_t GetMaxObservations() const { return(_m_maxObservations); }
+        /// Sets the max. nr. of observations per agent in a backup (0: all).
+        void SetMaxObservations(size_t maxObservations)
+            { _m_maxObservations = maxObservations; }
+
+        //get (data) functions:
+        JointPolicy* GetJointPolicy(void)
+            { return(GetJointPolicyPureVector()); }
+        JointPolicyDiscrete* GetJointPolicyDiscrete(void)
+            { return(GetJointPolicyPureVector()); }
+        /**Returns the found policy over observation histories, which is
+         * constructed on the first call after Plan(). */
+        JointPolicyPureVector* GetJointPolicyPureVector(void);
+        /// Returns the found policy trees as a PolicyAutomaton.
+        PolicyAutomaton GetPolicyAutomaton() const;
+        double GetExpectedReward(void) const
+            { return(_m_expectedRewardFoundPolicy); }
+        /// Returns the nr. of trees kept for agentI at stage.
+        size_t GetNrTrees(Index stage, Index agentI) const
+            { return(_m_treeActions.at(stage).at(agentI).size()); }
+
+};
+
+
+#endif /* !_MBDPPLANNER_H_ */
+
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -136,8 +136,8 @@ void MDPValueIteration::PlanSlow()
                             //find the best action at ssucI
                             maxQsuc = -DBL_MAX;
                             for(Index jasucI = 0; jasucI < nrJA; jasucI++)
-                                maxQsuc = max( _m_QValues[t+1](ssucI,jasucI),
-                                               maxQsuc);
+                                maxQsuc = max<double>(
+                                    _m_QValues[t+1](ssucI,jasucI), maxQsuc);
                             
                             R_f += GetPU()->GetTransitionProbability(sI, jaI,
                                                                      ssucI)
@@ -209,14 +209,14 @@ void MDPValueIteration::PlanSlow()
                         //find the best action at ssucI
                         maxQsuc = -DBL_MAX;
                         for(Index jasucI = 0; jasucI < nrJA; jasucI++)
-                            maxQsuc = max( oldQtable(ssucI,jasucI),
+                            maxQsuc = max<double>( oldQtable(ssucI,jasucI),
                                            maxQsuc);
                             
                         R_f += *ci * maxQsuc;
                     }//done calc. expected future reward
 
                     _m_QValues[0](sI,jaI) = R_i + gamma*R_f;
-                    maxDelta=max(maxDelta,abs(oldQtable(sI,jaI)-
+                    maxDelta=max<double>(maxDelta,abs(oldQtable(sI,jaI)-
                                               _m_QValues[0](sI,jaI)));
                 }//end for jaI
             }//end for sI
@@ -107,8 +107,9 @@ private:
                                 //find the best action at ssucI
                                 maxQsuc = -DBL_MAX;
                                 for(Index jasucI = 0; jasucI < nrJA; jasucI++)
-                                    maxQsuc = max( _m_QValues[t+1](ssucI,jasucI),
-                                                   maxQsuc);
+                                    maxQsuc = std::max<double>(
+                                        _m_QValues[t+1](ssucI,jasucI),
+                                        maxQsuc);
                             
                                 R_f += *ci * maxQsuc;
                             }//done calc. expected future reward
@@ -151,14 +152,14 @@ private:
                             //find the best action at ssucI
                             maxQsuc = -DBL_MAX;
                             for(Index jasucI = 0; jasucI < nrJA; jasucI++)
-                                maxQsuc = max( oldQtable(ssucI,jasucI),
-                                               maxQsuc);
+                                maxQsuc = std::max<double>(
+                                    oldQtable(ssucI,jasucI), maxQsuc);
                             
                             R_f += *ci * maxQsuc;
                         }//done calc. expected future reward
                         
                         _m_QValues[0](sI,jaI) = R_i + gamma*R_f;
-                        maxDelta=max(maxDelta,
+                        maxDelta=std::max<double>(maxDelta,
                                           std::abs(oldQtable(sI,jaI)-
                                                    _m_QValues[0](sI,jaI)));
                     }//end for jaI
@@ -217,8 +218,8 @@ public:
                 T.push_back(tm->GetMatrixPtr(a));
             Plan(T);
         }
-        else 
-            throw(E("MDPValueIteration::Plan() TransitionModelDiscretePtr not handled"));
+        else // e.g., a TransitionModel2DBN, which is not stored as matrices
+            PlanSlow();
             
         StopTimer("Plan");
     }
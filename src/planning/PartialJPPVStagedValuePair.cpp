@@ -0,0 +1,163 @@
+/**\file PartialJPPVStagedValuePair.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "PartialJPPVStagedValuePair.h"
+#include "PartialJointPolicyPureVector.h"
+#include "JointPolicyDiscretePure.h"
+
+using namespace std;
+
+PartialJPPVStage::PartialJPPVStage(
+    const boost::shared_ptr<const PartialJPPVStage>& parent,
+    size_t depth,
+    const JointPolicyDiscretePure& jpolBG,
+    const vector<size_t>& nrOHts,
+    const vector<Index>& firstOHtsI,
+    unsigned char bytesPerAction,
+    const vector<vector<Index> >* typeClusters) :
+    _m_parent(parent),
+    _m_depth(depth),
+    _m_firstOHI(firstOHtsI),
+    _m_offset(nrOHts.size()+1, 0),
+    _m_bytesPerAction(bytesPerAction)
+{
+    size_t nrAgents = nrOHts.size();
+    for(Index agentI=0; agentI < nrAgents; agentI++)
+        _m_offset[agentI+1] = _m_offset[agentI] + nrOHts[agentI];
+    _m_actions.resize(_m_offset[nrAgents] * _m_bytesPerAction);
+
+    for(Index agentI=0; agentI < nrAgents; agentI++)
+    {
+        for(Index type = 0; type < nrOHts[agentI]; type++)
+        {
+            Index bgType = typeClusters ? (*typeClusters)[agentI][type] : type;
+            Index aI = jpolBG.GetActionIndex(agentI, bgType);
+            unsigned char *p = &_m_actions[(_m_offset[agentI] + type) *
+                                           _m_bytesPerAction];
+            for(Index b=0; b < _m_bytesPerAction; b++)
+                p[b] = static_cast<unsigned char>(aI >> (8*b));
+        }
+    }
+}
+
+Index PartialJPPVStage::GetActionIndex(Index agentI, Index type) const
+{
+    const unsigned char *p = &_m_actions[(_m_offset[agentI] + type) *
+                                         _m_bytesPerAction];
+    Index aI = 0;
+    for(Index b=0; b < _m_bytesPerAction; b++)
+        aI |= static_cast<Index>(p[b]) << (8*b);
+    return(aI);
+}
+
+void PartialJPPVStage::WriteTo(PartialJointPolicyPureVector& jpol) const
+{
+    // walk up the chain iteratively, it can be as long as the horizon
+    const PartialJPPVStage *stage = this;
+    while(stage != 0)
+    {
+        size_t nrAgents = stage->_m_firstOHI.size();
+        for(Index agentI=0; agentI < nrAgents; agentI++)
+        {
+            size_t nrOH = stage->_m_offset[agentI+1] -
+                stage->_m_offset[agentI];
+            for(Index type = 0; type < nrOH; type++)
+                jpol.SetAction(agentI, stage->_m_firstOHI[agentI] + type,
+                               stage->GetActionIndex(agentI, type));
+        }
+        stage = stage->_m_parent.get();
+    }
+}
+
+unsigned char PartialJPPVStage::GetBytesPerAction(
+    const Interface_ProblemToPolicyDiscretePure& pu)
+{
+    size_t maxNrA = 0;
+    for(Index agentI=0; agentI < pu.GetNrAgents(); agentI++)
+        if(pu.GetNrActions(agentI) > maxNrA)
+            maxNrA = pu.GetNrActions(agentI);
+
+    if(maxNrA <= 0x100)
+        return(1);
+    else if(maxNrA <= 0x10000)
+        return(2);
+    else
+        return(sizeof(Index));
+}
+
+PartialJPPVStagedValuePair::PartialJPPVStagedValuePair(
+    const boost::shared_ptr<const PartialJPPVStage>& stage,
+    const Interface_ProblemToPolicyDiscretePure* pu,
+    double pastReward, double val) :
+    PartialJointPolicyValuePair(val),
+    _m_jpol(0),
+    _m_stage(stage),
+    _m_pastR(pastReward),
+    _m_pu(pu)
+{
+}
+
+PartialJPPVStagedValuePair::~PartialJPPVStagedValuePair()
+{
+    delete _m_jpol;
+}
+
+PartialJointPolicyPureVector* PartialJPPVStagedValuePair::GetPartialJPPV()
+{
+    if(_m_jpol==0)
+        AllocateJPPV();
+
+    return(_m_jpol);
+}
+
+void PartialJPPVStagedValuePair::AllocateJPPV()
+{
+    if(_m_jpol==0) // not yet instantiated, do it now
+    {
+        size_t depth = _m_stage ? _m_stage->GetDepth() : 0;
+        _m_jpol=new PartialJointPolicyPureVector(*_m_pu, OHIST_INDEX,
+                                                 _m_pastR, depth);
+        if(_m_stage)
+            _m_stage->WriteTo(*_m_jpol);
+    }
+}
+
+string PartialJPPVStagedValuePair::SoftPrint() const
+{
+    stringstream ss;
+    ss << "PartialJPPVStagedValuePair: val="<< GetValue() <<", depth:";
+    ss << (_m_stage ? _m_stage->GetDepth() : 0);
+    return(ss.str());
+}
+
+string PartialJPPVStagedValuePair::SoftPrintBrief() const
+{
+    stringstream ss;
+    ss << "PartialJPPVStagedValuePair(" << GetValue() << ",[d="
+       << (_m_stage ? _m_stage->GetDepth() : 0) << "])";
+    return(ss.str());
+}
@@ -0,0 +1,156 @@
+/**\file PartialJPPVStagedValuePair.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _PARTIALJPPVSTAGEDVALUEPAIR_H_
+#define _PARTIALJPPVSTAGEDVALUEPAIR_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "Globals.h"
+#include "PartialJointPolicyValuePair.h"
+#include "PartialJointPolicyPureVector.h"
+
+class JointPolicyDiscretePure;
+
+/**\brief PartialJPPVStage stores the actions of a partial joint policy
+ * for a single stage, and refers to the stage before it.
+ *
+ * A stage is never modified after construction, so all partial joint
+ * policies that extend the same parent share that parent (and
+ * recursively all its ancestors). Actions are packed in 1, 2 or 4
+ * bytes, depending on the largest number of individual actions.
+ */
+class PartialJPPVStage
+{
+private:
+    ///The stage before this one (0 for the first stage).
+    boost::shared_ptr<const PartialJPPVStage> _m_parent;
+    ///The depth of the partial joint policy that ends with this stage.
+    size_t _m_depth;
+    ///The index of the first observation history of this stage, per agent.
+    std::vector<Index> _m_firstOHI;
+    ///Where the actions of each agent start in _m_actions (nrAgents+1).
+    std::vector<size_t> _m_offset;
+    ///The number of bytes used to store a single action.
+    unsigned char _m_bytesPerAction;
+    ///The packed actions, for each agent and observation history.
+    std::vector<unsigned char> _m_actions;
+
+protected:
+
+public:
+    /**\brief Constructs a stage from a policy for a Bayesian game.
+     *
+     * The arguments are as for
+     * GeneralizedMAAStarPlannerForDecPOMDPDiscrete::ConstructExtendedJointPolicy().
+     */
+    PartialJPPVStage(const boost::shared_ptr<const PartialJPPVStage>& parent,
+                     size_t depth,
+                     const JointPolicyDiscretePure& jpolBG,
+                     const std::vector<size_t>& nrOHts,
+                     const std::vector<Index>& firstOHtsI,
+                     unsigned char bytesPerAction,
+                     const std::vector<std::vector<Index> >* typeClusters=0);
+
+    size_t GetDepth() const
+        { return(_m_depth); }
+    const boost::shared_ptr<const PartialJPPVStage>& GetParent() const
+        { return(_m_parent); }
+
+    /// Returns the action of agentI for the type-th history of this stage.
+    Index GetActionIndex(Index agentI, Index type) const;
+
+    /// Writes the actions of this stage and all its ancestors to jpol.
+    void WriteTo(PartialJointPolicyPureVector& jpol) const;
+
+    /// Returns the nr. of bytes needed to store any action of pu.
+    static unsigned char
+    GetBytesPerAction(const Interface_ProblemToPolicyDiscretePure& pu);
+};
+
+/**\brief PartialJPPVStagedValuePair represents a
+ * (PartialJointPolicyPureVector,Value) pair, which only stores the
+ * last stage of the joint policy.
+ *
+ * The earlier stages are shared with the policy pool item it was
+ * expanded from (see PartialJPPVStage). The full
+ * PartialJointPolicyPureVector is constructed on demand by GetJPol(),
+ * which in GMAA only happens for the few items that are actually
+ * selected for expansion. Like PartialJPPVIndexValuePair, this class
+ * should be preferred when a lot of partial policies are kept in
+ * the policy pool, but it does not need the joint policy to have an
+ * LIndex that fits in memory.
+ */
+class PartialJPPVStagedValuePair : public PartialJointPolicyValuePair
+{
+private:
+
+    PartialJointPolicyPureVector* _m_jpol;
+    boost::shared_ptr<const PartialJPPVStage> _m_stage;
+    double _m_pastR;
+    const Interface_ProblemToPolicyDiscretePure *_m_pu;
+
+    void AllocateJPPV();
+
+protected:
+
+public:
+    // Constructor, destructor and copy assignment.
+
+    /**\brief Constructor.
+     *
+     * stage is the last stage of the partial joint policy, and pu the
+     * problem it is defined on.*/
+    PartialJPPVStagedValuePair(
+        const boost::shared_ptr<const PartialJPPVStage>& stage,
+        const Interface_ProblemToPolicyDiscretePure* pu,
+        double pastReward, double val);
+
+    /// Destructor.
+    ~PartialJPPVStagedValuePair();
+
+    PartialJointPolicyDiscretePure* GetJPol()
+    { return GetPartialJPPV();}
+    PartialJointPolicyPureVector* GetPartialJPPV();
+
+    /// Returns the last stage of the wrapped policy.
+    const boost::shared_ptr<const PartialJPPVStage>& GetStage() const
+    { return(_m_stage); }
+
+    std::string SoftPrint() const;
+    std::string SoftPrintBrief() const;
+};
+
+
+#endif /* !_PARTIALJPPVSTAGEDVALUEPAIR_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -46,6 +46,7 @@ Perseus::Perseus(const PlanningUnitDecPOMDPDiscrete& pu) :
     _m_storeIntermediateValueFunctions(false),
     _m_storeTimings(false),
     _m_computeVectorForEachBelief(false),
+    _m_lazyBackProjection(false),
     _m_dryrun(false)
 {
     SetMinimumNumberOfIterations(10);
@@ -296,20 +297,22 @@ void Perseus::PlanLeadOut()
     }
 }
 
-GaoVectorSet
+BackProjection*
 Perseus::BackupStageLeadIn(const ValueFunctionPOMDPDiscrete &V) const
 {
     StartTimer(GetIdentification() + "BackupStage");
 
-    return(BackProject(V));
+    return(new BackProjection(*this,V,_m_lazyBackProjection));
 }
 
-void Perseus::BackupStageLeadOut(GaoVectorSet Gao) const
+void Perseus::BackupStageLeadOut(BackProjection *Gao) const
 {
+    if(GetVerbose() >= 2 && Gao->IsLazy())
+        cout << "Perseus: back-projected " << Gao->GetNrComputed()
+             << " vectors" << endl;
+
     // release the memory of the back-projected vectors
-    for(unsigned int a=0;a!=GetPU()->GetNrJointActions();a++)
-        for(unsigned int o=0;o!=GetPU()->GetNrJointObservations();o++)
-            delete(Gao[a][o]);
+    delete(Gao);
     
     StopTimer(GetIdentification() + "BackupStage");
 }
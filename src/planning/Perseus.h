@@ -36,6 +36,7 @@
 
 #include "BeliefValue.h"
 #include "AlphaVectorPlanning.h"
+#include "BackProjection.h"
 #include "directories.h"
 #include "PlanningUnitDecPOMDPDiscrete.h"
 #include "QAVParameters.h"
@@ -97,6 +98,9 @@ protected:
 
     bool _m_computeVectorForEachBelief;
 
+    /// Whether back-projected vectors are only computed when needed.
+    bool _m_lazyBackProjection;
+
     bool _m_dryrun;
 
     template <class VF>
@@ -161,9 +165,11 @@ protected:
 
     void PlanLeadOut();
 
-    GaoVectorSet BackupStageLeadIn(const ValueFunctionPOMDPDiscrete &V) const;
+    /// Returns the back-projection of \a V for a backup stage.
+    BackProjection* BackupStageLeadIn(const ValueFunctionPOMDPDiscrete &V)
+        const;
 
-    void BackupStageLeadOut(GaoVectorSet Gao) const;
+    void BackupStageLeadOut(BackProjection *Gao) const;
 
     void UpdateValueFunctionName();
 
@@ -231,6 +237,10 @@ public:
     void SetComputeVectorForEachBelief(bool compute)
         { _m_computeVectorForEachBelief = compute; }
 
+    /// Only compute the back-projected vectors a belief backup needs.
+    void SetLazyBackProjection(bool lazy)
+        { _m_lazyBackProjection = lazy; }
+
     void SetMinimumNumberOfIterations(int nr)
         { _m_minimumNumberOfIterations=nr; }
     void SetMaximumNumberOfIterations(int nr)
@@ -94,7 +94,7 @@ PerseusBGPlanner::BackupStageAll(const BeliefSet &S,
     AlphaVector alpha(nrS);
 
     ValueFunctionPOMDPDiscrete V=QFunctionsToValueFunction(Q);
-    GaoVectorSet Gao=BackupStageLeadIn(V);
+    BackProjection *Gao=BackupStageLeadIn(V);
 
     ValueFunctionPOMDPDiscrete Qalphas;
 
@@ -104,7 +104,7 @@ PerseusBGPlanner::BackupStageAll(const BeliefSet &S,
         for(unsigned int a=0;a!=GetPU()->GetNrJointActions();++a)
         {
             // backup the belief
-            alpha=BeliefBackup(*S[k],a,Gao,V,_m_backupType);
+            alpha=BeliefBackup(*S[k],a,*Gao,V,_m_backupType);
            
             // add alpha to Q1
             if(!VectorIsInValueFunction(alpha,Q1[a]))
@@ -146,7 +146,7 @@ PerseusBGPlanner::BackupStageSampling(const BeliefSet &S,
     AlphaVector alpha(nrS);
 
     ValueFunctionPOMDPDiscrete V=QFunctionsToValueFunction(Q);
-    GaoVectorSet Gao=BackupStageLeadIn(V);
+    BackProjection *Gao=BackupStageLeadIn(V);
 
     ValueFunctionPOMDPDiscrete Qalphas;
 
@@ -159,7 +159,7 @@ PerseusBGPlanner::BackupStageSampling(const BeliefSet &S,
         for(unsigned int a=0;a!=GetPU()->GetNrJointActions();++a)
         {
             // backup the belief
-            alpha=BeliefBackup(*S[k],a,Gao,V,_m_backupType);
+            alpha=BeliefBackup(*S[k],a,*Gao,V,_m_backupType);
 
             // check whether alpha improves the value of S[k]
             double x=S[k]->InnerProduct(alpha.GetValues());
@@ -224,7 +224,7 @@ PerseusBGPlanner::BackupStageSamplingAlt(const BeliefSet &S,
     AlphaVector alpha(nrS);
 
     ValueFunctionPOMDPDiscrete V=QFunctionsToValueFunction(Q);
-    GaoVectorSet Gao=BackupStageLeadIn(V);
+    BackProjection *Gao=BackupStageLeadIn(V);
 
     ValueFunctionPOMDPDiscrete Qalphas;
 
@@ -238,7 +238,7 @@ PerseusBGPlanner::BackupStageSamplingAlt(const BeliefSet &S,
             // sample a belief index from the number of not improved beliefs
             k=SampleNotImprovedBeliefIndex(stillNeedToBeImproved,nrNotImproved);
             // backup the belief
-            alpha=BeliefBackup(*S[k],a,Gao,V,_m_backupType);
+            alpha=BeliefBackup(*S[k],a,*Gao,V,_m_backupType);
 
             // check whether alpha improves the value of S[k]
             double x=S[k]->InnerProduct(alpha.GetValues());
@@ -120,7 +120,7 @@ PerseusPOMDPPlanner::BackupStage(const BeliefSet &S,
     ValueFunctionPOMDPDiscrete V1;
     AlphaVector alpha(nrS);
 
-    GaoVectorSet Gao=BackupStageLeadIn(V);
+    BackProjection *Gao=BackupStageLeadIn(V);
 
     if(_m_computeVectorForEachBelief)
         k=-1;
@@ -132,7 +132,7 @@ PerseusPOMDPPlanner::BackupStage(const BeliefSet &S,
         else // sample a belief index from the number of not improved beliefs
             k=SampleNotImprovedBeliefIndex(stillNeedToBeImproved,nrNotImproved);
 
-        alpha=BeliefBackup(*S[k],Gao);
+        alpha=BeliefBackup(*S[k],*Gao);
 
         if(!_m_computeVectorForEachBelief)
         {
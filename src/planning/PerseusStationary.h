@@ -74,7 +74,7 @@ public:
     ValueFunctionPOMDPDiscrete GetValueFunction() const
         { return(_m_valueFunction); }
 
-    QFunctionsDiscrete GetQFunctions() const
+    const QFunctionsDiscrete& GetQFunctions() const
         { return(_m_qFunction); }
 
     double GetQ(const JointBeliefInterface &b, Index jaI) const;
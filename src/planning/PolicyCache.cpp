@@ -0,0 +1,306 @@
+/**\file PolicyCache.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include "PolicyCache.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "E.h"
+#include "directories.h"
+#include "DecPOMDPDiscreteInterface.h"
+#include "JointPolicyDiscretePure.h"
+#include "Interface_ProblemToPolicyDiscretePure.h"
+#include "QFunctionJAOHInterface.h"
+
+using namespace std;
+
+/// Identifies a joint policy entry (and its format version).
+static const char PolicyCache_Magic[8]={'M','A','D','P','J','P','0','1'};
+
+/// Incremental 64-bit FNV-1a hash.
+class PolicyCacheHash
+{
+private:
+    unsigned long long _m_h;
+public:
+    PolicyCacheHash() : _m_h(14695981039346656037ULL) {}
+
+    void Add(const void *data, size_t n)
+    {
+        const unsigned char *p=static_cast<const unsigned char*>(data);
+        for(size_t i=0;i!=n;++i)
+        {
+            _m_h^=p[i];
+            _m_h*=1099511628211ULL;
+        }
+    }
+    void Add(size_t i)
+    {
+        unsigned long long v=i;
+        Add(&v,sizeof(v));
+    }
+    void Add(double d) { Add(&d,sizeof(d)); }
+    void Add(const string &s) { Add(s.size()); Add(s.data(),s.size()); }
+
+    string SoftPrint() const
+    {
+        stringstream ss;
+        ss << hex << setw(16) << setfill('0') << _m_h;
+        return(ss.str());
+    }
+};
+
+PolicyCache::PolicyCache(unsigned long long maxBytes) :
+    _m_dir(directories::MADPGetCacheDir()),
+    _m_maxBytes(maxBytes)
+{
+    directories::MADPCreateCacheDir();
+}
+
+PolicyCache::PolicyCache(const string &dir, unsigned long long maxBytes) :
+    _m_dir(dir),
+    _m_maxBytes(maxBytes)
+{
+}
+
+string PolicyCache::GetKey(const DecPOMDPDiscreteInterface &problem,
+                           const string &settings)
+{
+    // the model, as far as it influences any planner
+    PolicyCacheHash model;
+    size_t nrS=problem.GetNrStates(),
+        nrJA=problem.GetNrJointActions(),
+        nrJO=problem.GetNrJointObservations();
+    model.Add(problem.GetNrAgents());
+    for(Index agentI=0;agentI!=problem.GetNrAgents();++agentI)
+    {
+        model.Add(problem.GetNrActions(agentI));
+        model.Add(problem.GetNrObservations(agentI));
+    }
+    model.Add(nrS);
+    model.Add(problem.GetDiscount());
+    for(Index sI=0;sI!=nrS;++sI)
+        model.Add(problem.GetInitialStateProbability(sI));
+    for(Index sI=0;sI!=nrS;++sI)
+        for(Index jaI=0;jaI!=nrJA;++jaI)
+        {
+            model.Add(problem.GetReward(sI,jaI));
+            for(Index sucSI=0;sucSI!=nrS;++sucSI)
+                model.Add(problem.GetTransitionProbability(sI,jaI,sucSI));
+        }
+    for(Index jaI=0;jaI!=nrJA;++jaI)
+        for(Index sucSI=0;sucSI!=nrS;++sucSI)
+            for(Index joI=0;joI!=nrJO;++joI)
+                model.Add(problem.GetObservationProbability(jaI,sucSI,joI));
+
+    PolicyCacheHash planner;
+    planner.Add(settings);
+
+    return(model.SoftPrint() + "_" + planner.SoftPrint());
+}
+
+string PolicyCache::GetFilename(const string &key, const string &kind) const
+{
+    return(_m_dir + "/" + key + "." + kind);
+}
+
+bool PolicyCache::Store(const string &tmpFilename,
+                        const string &filename) const
+{
+    if(!directories::MADPReplaceFile(tmpFilename,filename))
+    {
+        remove(tmpFilename.c_str());
+        return(false);
+    }
+    Evict();
+    return(true);
+}
+
+void PolicyCache::Evict() const
+{
+    vector<string> files=directories::MADPListFiles(_m_dir);
+    vector<pair<time_t,string> > entries;
+    unsigned long long totalBytes=0;
+    time_t now=time(0);
+
+    for(Index i=0;i!=files.size();++i)
+    {
+        string filename=_m_dir + "/" + files[i];
+        struct stat statInfo;
+        if(stat(filename.c_str(),&statInfo)!=0)
+            continue;
+        if(files[i].find(".tmp.")!=string::npos)
+        {
+            if(now-statInfo.st_mtime > PolicyCache_StaleTempSeconds)
+                remove(filename.c_str());
+            continue;
+        }
+        entries.push_back(make_pair(statInfo.st_mtime,filename));
+        totalBytes+=statInfo.st_size;
+    }
+
+    // least recently used first
+    sort(entries.begin(),entries.end());
+    for(Index i=0;i!=entries.size() && totalBytes>_m_maxBytes;++i)
+    {
+        struct stat statInfo;
+        if(stat(entries[i].second.c_str(),&statInfo)==0 &&
+           remove(entries[i].second.c_str())==0)
+            totalBytes-=statInfo.st_size;
+    }
+}
+
+bool PolicyCache::LoadJointPolicy(const string &key,
+                                  JointPolicyDiscretePure &jpol,
+                                  double &value) const
+{
+    string filename=GetFilename(key,"jpol");
+    ifstream fp(filename.c_str(),ios::in | ios::binary);
+    if(!fp)
+        return(false);
+
+    char magic[sizeof(PolicyCache_Magic)];
+    Index nrAgents,category;
+    fp.read(magic,sizeof(magic));
+    fp.read(reinterpret_cast<char*>(&nrAgents),sizeof(Index));
+    fp.read(reinterpret_cast<char*>(&category),sizeof(Index));
+    if(!fp || !equal(magic,magic+sizeof(magic),PolicyCache_Magic) ||
+       nrAgents!=jpol.GetNrAgents() ||
+       category!=static_cast<Index>(jpol.GetIndexDomainCategory()))
+        return(false);
+
+    // read everything before touching jpol
+    vector<vector<Index> > actions(nrAgents);
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+    {
+        Index nrElements;
+        fp.read(reinterpret_cast<char*>(&nrElements),sizeof(Index));
+        if(!fp || nrElements!=jpol.GetNrDomainElements(agentI))
+            return(false);
+        actions[agentI].resize(nrElements);
+        if(nrElements>0)
+            fp.read(reinterpret_cast<char*>(&actions[agentI][0]),
+                    nrElements*sizeof(Index));
+        size_t nrA=jpol.GetInterfacePTPDiscretePure()->GetNrActions(agentI);
+        for(Index i=0;i!=nrElements;++i)
+            if(actions[agentI][i]>=nrA)
+                return(false);
+    }
+    double v;
+    fp.read(reinterpret_cast<char*>(&v),sizeof(double));
+    if(!fp)
+        return(false);
+
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+        for(Index i=0;i!=actions[agentI].size();++i)
+            jpol.SetAction(agentI,i,actions[agentI][i]);
+    value=v;
+
+    directories::MADPTouchFile(filename);
+    return(true);
+}
+
+bool PolicyCache::SaveJointPolicy(const string &key,
+                                  const JointPolicyDiscretePure &jpol,
+                                  double value) const
+{
+    string filename=GetFilename(key,"jpol"),
+        tmpFilename=directories::MADPGetUniqueFilename(filename + ".tmp");
+    {
+        ofstream fp(tmpFilename.c_str(),ios::out | ios::binary);
+        if(!fp)
+            return(false);
+
+        Index nrAgents=jpol.GetNrAgents(),
+            category=jpol.GetIndexDomainCategory();
+        fp.write(PolicyCache_Magic,sizeof(PolicyCache_Magic));
+        fp.write(reinterpret_cast<const char*>(&nrAgents),sizeof(Index));
+        fp.write(reinterpret_cast<const char*>(&category),sizeof(Index));
+        for(Index agentI=0;agentI!=nrAgents;++agentI)
+        {
+            Index nrElements=jpol.GetNrDomainElements(agentI);
+            fp.write(reinterpret_cast<const char*>(&nrElements),sizeof(Index));
+            for(Index i=0;i!=nrElements;++i)
+            {
+                Index aI=jpol.GetActionIndex(agentI,i);
+                fp.write(reinterpret_cast<const char*>(&aI),sizeof(Index));
+            }
+        }
+        fp.write(reinterpret_cast<const char*>(&value),sizeof(double));
+
+        fp.close();
+        if(!fp)
+        {
+            remove(tmpFilename.c_str());
+            return(false);
+        }
+    }
+    return(Store(tmpFilename,filename));
+}
+
+bool PolicyCache::LoadQHeuristic(const string &key,
+                                 QFunctionJAOHInterface &q) const
+{
+    string filename=GetFilename(key,"qheur");
+    {
+        ifstream fp(filename.c_str());
+        if(!fp)
+            return(false);
+    }
+
+    try {
+        q.Load(filename);
+    }
+    catch(E& e){
+        return(false);
+    }
+
+    directories::MADPTouchFile(filename);
+    return(true);
+}
+
+bool PolicyCache::SaveQHeuristic(const string &key,
+                                 const QFunctionJAOHInterface &q) const
+{
+    string filename=GetFilename(key,"qheur"),
+        tmpFilename=directories::MADPGetUniqueFilename(filename + ".tmp");
+    try {
+        q.Save(tmpFilename);
+    }
+    catch(E& e){
+        remove(tmpFilename.c_str());
+        return(false);
+    }
+    return(Store(tmpFilename,filename));
+}
@@ -0,0 +1,118 @@
+/**\file PolicyCache.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _POLICYCACHE_H_
+#define _POLICYCACHE_H_ 1
+
+/* the include directives */
+#include <string>
+#include "Globals.h"
+
+class DecPOMDPDiscreteInterface;
+class JointPolicyDiscretePure;
+class QFunctionJAOHInterface;
+
+/// The default maximum size of the cache, in bytes.
+#define PolicyCache_MaxBytes (512ULL*1024*1024)
+/// Temporary files older than this (in seconds) are left over by a
+/// crashed writer, and are removed on eviction.
+#define PolicyCache_StaleTempSeconds (24*60*60)
+
+/**\brief PolicyCache is a persistent, content-addressed cache of
+ * solved joint policies (with their value) and Q-value heuristics.
+ *
+ * Entries are keyed by GetKey(), a hash of the parsed model together
+ * with a description of the planner and its settings, so a cached
+ * result is found regardless of the name or location of the problem
+ * file, and is never returned for a model that changed. Entries are
+ * written to a unique temporary file which is then renamed, so
+ * concurrent processes never read a partial entry. When the total
+ * size exceeds the maximum, the least recently used entries are
+ * evicted.
+ *
+ * The cache is best-effort: Load*() return false on a miss or on an
+ * unreadable entry, and Save*() return false when the entry could not
+ * be written.
+ */
+class PolicyCache 
+{
+private:    
+    /// The directory holding the entries.
+    std::string _m_dir;
+    /// The maximum total size of the entries in bytes.
+    unsigned long long _m_maxBytes;
+
+    std::string GetFilename(const std::string &key,
+                            const std::string &kind) const;
+    /// Moves a completely written \a tmpFilename to \a filename.
+    bool Store(const std::string &tmpFilename,
+               const std::string &filename) const;
+    void Evict() const;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Uses directories::MADPGetCacheDir(), which is created if needed.
+    PolicyCache(unsigned long long maxBytes=PolicyCache_MaxBytes);
+    /// Uses (existing) directory \a dir.
+    PolicyCache(const std::string &dir,
+                unsigned long long maxBytes=PolicyCache_MaxBytes);
+
+    /**\brief Returns the key of the result of a planner described by
+     * \a settings on \a problem.
+     *
+     * \a settings should name the method and every parameter that
+     * influences its result, such as the horizon.*/
+    static std::string GetKey(const DecPOMDPDiscreteInterface &problem,
+                              const std::string &settings);
+
+    /**\brief Reads the joint policy stored under \a key into \a jpol.
+     *
+     * \a jpol has to be defined on the same problem and horizon as the
+     * stored one.*/
+    bool LoadJointPolicy(const std::string &key,
+                         JointPolicyDiscretePure &jpol, double &value) const;
+    bool SaveJointPolicy(const std::string &key,
+                         const JointPolicyDiscretePure &jpol,
+                         double value) const;
+
+    /// Reads the Q-values stored under \a key into \a q.
+    bool LoadQHeuristic(const std::string &key,
+                        QFunctionJAOHInterface &q) const;
+    bool SaveQHeuristic(const std::string &key,
+                        const QFunctionJAOHInterface &q) const;
+};
+
+
+#endif /* !_POLICYCACHE_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
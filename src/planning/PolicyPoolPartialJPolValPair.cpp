@@ -34,7 +34,7 @@ using namespace std;
 //Default constructor
 PolicyPoolPartialJPolValPair::PolicyPoolPartialJPolValPair()
 {   
-    _m_jpvpQueue_p = new priority_queue<PartialJPDPValuePair*>(); //&JPolValPool;    
+    _m_jpvpQueue_p = new priority_queue<PartialJointPolicyValuePair*>(); //&JPolValPool;    
 }
 
 
@@ -127,10 +127,11 @@ void PolicyPoolPartialJPolValPair::Pop()
 
 void PolicyPoolPartialJPolValPair::Insert(PartialPolicyPoolItemInterface*  ppi)
 {
-    PartialJPDPValuePair* jp = dynamic_cast<PartialJPDPValuePair*>(ppi);
+    PartialJointPolicyValuePair* jp = 
+        dynamic_cast<PartialJointPolicyValuePair*>(ppi);
 
     if(jp==0)
-         throw(E("PolicyPoolPartialJPolValPair::Insert could not cast input to PartialJPDPValuePair"));
+         throw(E("PolicyPoolPartialJPolValPair::Insert could not cast input to PartialJointPolicyValuePair"));
        
     _m_jpvpQueue_p->push(jp);
     
@@ -152,12 +153,12 @@ void PolicyPoolPartialJPolValPair::Union(PartialPolicyPoolInterface*  o_ppi)
 
 void PolicyPoolPartialJPolValPair::Prune(double v)
 {
-     priority_queue<PartialJPDPValuePair*> * new_jpvpQueue_p = 
-         new priority_queue<PartialJPDPValuePair*>;
+     priority_queue<PartialJointPolicyValuePair*> * new_jpvpQueue_p = 
+         new priority_queue<PartialJointPolicyValuePair*>;
 
      while(_m_jpvpQueue_p->size() > 0)
      {
-         PartialJPDPValuePair* jpvp = _m_jpvpQueue_p->top();
+         PartialJointPolicyValuePair* jpvp = _m_jpvpQueue_p->top();
          if(jpvp->GetValue() > v)
          {
              new_jpvpQueue_p->push(jpvp);
@@ -43,8 +43,8 @@
 class PolicyPoolPartialJPolValPair : public PartialPolicyPoolInterface 
 {
     private:   
-        ///The pointer to the PartialJPDPValuePair queue
-        std::priority_queue<PartialJPDPValuePair*> * _m_jpvpQueue_p;
+        ///The pointer to the PartialJointPolicyValuePair queue
+        std::priority_queue<PartialJointPolicyValuePair*> * _m_jpvpQueue_p;
     
     protected:
     
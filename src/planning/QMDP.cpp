@@ -136,6 +136,9 @@ void QMDP::Save(string filename) const
 
 void QMDP::Load(string filename)
 {
+    if(!_m_initialized)
+        Initialize();
+
     if(_m_useJaohQValuesCache)
         _m_QValues=MDPSolver::LoadQTable(filename,
                                          GetPU()->
@@ -0,0 +1,99 @@
+/**\file QPOMDPIncrementalPruning.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "QPOMDPIncrementalPruning.h"
+#include "IncrementalPruningPlanner.h"
+#include "JointBeliefInterface.h"
+#include "PlanningUnitDecPOMDPDiscrete.h"
+
+using namespace std;
+
+//Default constructor
+QPOMDPIncrementalPruning::QPOMDPIncrementalPruning(const
+                                                   PlanningUnitDecPOMDPDiscrete&
+                                                   pu) :
+    QFunctionForDecPOMDP(pu), //virtual base first
+    QFunctionJAOH(pu),
+    _m_p(0),
+    _m_initialized(false)
+{
+}
+
+//Destructor
+QPOMDPIncrementalPruning::~QPOMDPIncrementalPruning()
+{
+    DeInitialize();
+}
+
+void QPOMDPIncrementalPruning::Initialize()
+{
+    _m_p=new IncrementalPruningPlanner(*GetPU());
+    _m_initialized=true;
+}
+
+void QPOMDPIncrementalPruning::DeInitialize()
+{
+    delete _m_p;
+    _m_p=0;
+    _m_initialized=false;
+}
+
+void QPOMDPIncrementalPruning::SetPU(const PlanningUnitDecPOMDPDiscrete& pu)
+{
+    DeInitialize();
+    QFunctionJAOH::SetPU(pu);
+}
+
+void QPOMDPIncrementalPruning::Compute()
+{
+    if(!_m_initialized)
+        Initialize();
+
+    _m_p->SetVerbose(-1);
+    _m_p->Plan();
+}
+
+double QPOMDPIncrementalPruning::GetQ(Index jaohI, Index jaI) const
+{
+    Index t=GetPU()->GetTimeStepForJAOHI(jaohI);
+    JointBeliefInterface *jb=GetPU()->GetJointBeliefInterface(jaohI);
+    double q=_m_p->GetQ(*jb,t,jaI);
+    delete jb;
+    return(q);
+}
+
+double QPOMDPIncrementalPruning::GetQ(const JointBeliefInterface &b,
+                                      Index jaI) const
+{
+    return(_m_p->GetQ(b,jaI));
+}
+
+double QPOMDPIncrementalPruning::GetQ(const JointBeliefInterface &b,
+                                      Index time_step, Index jaI) const
+{
+    return(_m_p->GetQ(b,time_step,jaI));
+}
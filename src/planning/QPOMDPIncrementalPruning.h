@@ -0,0 +1,91 @@
+/**\file QPOMDPIncrementalPruning.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _QPOMDPINCREMENTALPRUNING_H_
+#define _QPOMDPINCREMENTALPRUNING_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include "Globals.h"
+
+#include "QFunctionJAOH.h"
+#include "QFunctionJointBeliefInterface.h"
+
+class IncrementalPruningPlanner;
+
+/**\brief QPOMDPIncrementalPruning is the QPOMDP heuristic, computed
+ * by an IncrementalPruningPlanner instead of on the tree of joint
+ * action-observation histories (as QPOMDP does).
+ *
+ * The resulting Q-values are the same, but the cost of Compute()
+ * depends on the size of the value functions instead of on the
+ * number of joint histories, and GetQ() computes the joint belief
+ * of a history on demand. */
+class QPOMDPIncrementalPruning : virtual public QFunctionJAOH,
+                                 virtual public QFunctionJointBeliefInterface
+{
+private:
+
+    IncrementalPruningPlanner *_m_p;
+
+    bool _m_initialized;
+
+    void Initialize();
+    void DeInitialize();
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// (default) Constructor
+    QPOMDPIncrementalPruning(const PlanningUnitDecPOMDPDiscrete& pu);
+    /// Destructor.
+    ~QPOMDPIncrementalPruning();
+    
+    /// Computes the Q functions of all stages.
+    void Compute();
+
+    void SetPU(const PlanningUnitDecPOMDPDiscrete& pu);
+
+    /// Returns Q(\a jaohI, \a jaI), using the time step of \a jaohI.
+    double GetQ(Index jaohI, Index jaI) const;
+
+    double GetQ(const JointBeliefInterface &b, Index jaI) const;
+    double GetQ(const JointBeliefInterface &b, Index time_step,
+                Index jaI) const;
+
+    IncrementalPruningPlanner* GetPlanner() const
+        { return(_m_p); }
+};
+
+
+#endif /* !_QPOMDPINCREMENTALPRUNING_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
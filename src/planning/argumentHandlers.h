@@ -66,6 +66,7 @@ struct Arguments
     size_t nrAgents;
     size_t nrHouses;
     size_t nrFLs;
+    bool factoredModel;
 
     //output file options (outputFileOptions)
     int dryrun;
@@ -74,11 +75,13 @@ struct Arguments
     //model options (modelOptions)
     int sparse;
     int isTOI;
+    int lazyJointSpaces;
     double discount;
 
     //solution methods options (solutionMethodOptions)
     int horizon;
     int infiniteHorizon;
+    int usePolicyCache;
 
     //the jpolIndex input argument
     LIndex jpolIndex;
@@ -88,6 +91,7 @@ struct Arguments
     BGIP_Solver_t bgsolver; //the BG solver type
     int nrRestarts; //the number of times that the GMAA algorithm is run
     int k;
+    int clustering; //cluster equivalent histories (GMAA and JESP)
     
     
     
@@ -95,6 +99,11 @@ struct Arguments
     // JESP options
     JESP_t jesp;
     int JESPnrRestarts;
+    // MBDP options
+    int MBDPmaxTrees;
+    double MBDPexploration;
+    int MBDPnrRestarts;
+    int MBDPmaxObservations; //only used by IMBDP
     // alternating maximization options
     int nrAMRestarts;
 
@@ -121,6 +130,7 @@ struct Arguments
     double weight;
     int commModel;
     int computeVectorForEachBelief;
+    int lazyBackProjection;
     
     // Qheur options
     Qheur_t qheur;
@@ -156,6 +166,7 @@ struct Arguments
         nrAgents = 2;
         nrHouses = 3;
         nrFLs = 3;
+        factoredModel = false;
         // output
         dryrun = 0;
         description = NULL;
@@ -164,11 +175,13 @@ struct Arguments
         // model
         sparse = 0;
         isTOI = 0;
+        lazyJointSpaces = 0;
         discount = -1;
 
         // solution method
         horizon = 2;
         infiniteHorizon = 0;
+        usePolicyCache = 0;
 
         // jpol index
         jpolIndex = 0;
@@ -179,6 +192,7 @@ struct Arguments
         nrRestarts = 1;
         nrAMRestarts = 10;
         k = 1;
+        clustering = 0;
 
         
         
@@ -186,6 +200,12 @@ struct Arguments
         jesp = JESPDP;
         JESPnrRestarts = 10;
 
+        //MBDP options
+        MBDPmaxTrees = 3;
+        MBDPexploration = 0.5;
+        MBDPnrRestarts = 1;
+        MBDPmaxObservations = 2;
+
         // Perseus
         savePOMDP = 0;
         saveIntermediateV = 0;
@@ -209,6 +229,7 @@ struct Arguments
         weight = -1;
         commModel = -1;
         computeVectorForEachBelief = 0;
+        lazyBackProjection = 0;
 
         // Qheur options
         qheur = eQMDP;
@@ -284,6 +305,10 @@ error_t JESP_parse_argument (int key, char *arg,
                              struct argp_state *state);
 extern const struct argp_child JESP_child;
 
+error_t MBDP_parse_argument (int key, char *arg, 
+                             struct argp_state *state);
+extern const struct argp_child MBDP_child;
+
 
 } //namespace
 
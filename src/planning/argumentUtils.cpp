@@ -56,7 +56,7 @@ DecPOMDPDiscreteInterface* GetDecPOMDPDiscreteInterfaceFromArgs(const Arguments&
         case(ProblemType::FF):
         {
             dp = new ProblemFireFighting(args.nrAgents, args.nrHouses, 
-                    args.nrFLs);
+                    args.nrFLs, 0.0, false, args.factoredModel);
             break;
         }
 
@@ -71,6 +71,8 @@ DecPOMDPDiscreteInterface* GetDecPOMDPDiscreteInterfaceFromArgs(const Arguments&
                     new TOIFactoredRewardDecPOMDPDiscrete("","",dpomdpFile);
                 if(args.sparse)
                     toi->SetSparse(true);
+                if(args.lazyJointSpaces)
+                    toi->SetLazyJointSpaces(true);
                 MADPParser parser(toi);
                 if(args.sparse)
                     toi->CreateCentralizedSparseModels();
@@ -85,6 +87,8 @@ DecPOMDPDiscreteInterface* GetDecPOMDPDiscreteInterfaceFromArgs(const Arguments&
                     new DecPOMDPDiscrete("","",dpomdpFile);
                 if(args.sparse)
                     decpomdp->SetSparse(true);
+                if(args.lazyJointSpaces)
+                    decpomdp->SetLazyJointSpaces(true);
                 MADPParser parser(decpomdp);
                 dp = decpomdp;
             }
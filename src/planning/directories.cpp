@@ -31,6 +31,8 @@
 //#include <wordexp.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/utime.h>
+#include <sstream>
 //#include <unistd.h>
 #include "PlanningUnit.h"
 #include "MultiAgentDecisionProcessInterface.h"
@@ -215,3 +217,62 @@ string directories::MADPGetProblemFilename(const
     else
         return(MADPGetProblemFilename(args.dpf,"dpomdp"));
 }
+
+string directories::MADPGetCacheDir()
+{
+	char * strPath = "%USERPROFILE%/.madp/cache";
+	char cOutputPath[MAX_PATH];
+	ExpandEnvironmentStringsA(strPath, cOutputPath, MAX_PATH);
+    return string(cOutputPath);
+}
+
+void directories::MADPCreateCacheDir()
+{
+    string dir=MADPGetCacheDir();
+
+    struct stat statInfo;
+    if(stat(dir.c_str(),&statInfo)==0 &&
+       (((statInfo.st_mode) & S_IFMT) == S_IFDIR))
+        return;
+
+    // ~/.madp might not exist yet either
+    _mkdir(dir.substr(0,dir.rfind('/')).c_str());
+    if(_mkdir(dir.c_str())!=0)
+        perror("mkdir error");
+}
+
+vector<string> directories::MADPListFiles(const string &dir)
+{
+    vector<string> files;
+    WIN32_FIND_DATAA data;
+    HANDLE h=FindFirstFileA((dir + "/*").c_str(),&data);
+    if(h==INVALID_HANDLE_VALUE)
+        return(files);
+    do
+    {
+        if(!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            files.push_back(data.cFileName);
+    }
+    while(FindNextFileA(h,&data));
+    FindClose(h);
+    return(files);
+}
+
+string directories::MADPGetUniqueFilename(const string &base)
+{
+    static long counter=0;
+    stringstream ss;
+    ss << base << "." << GetCurrentProcessId() << "." << GetCurrentThreadId()
+       << "." << InterlockedIncrement(&counter);
+    return(ss.str());
+}
+
+bool directories::MADPReplaceFile(const string &from, const string &to)
+{
+    return(MoveFileExA(from.c_str(),to.c_str(),MOVEFILE_REPLACE_EXISTING)!=0);
+}
+
+void directories::MADPTouchFile(const string &filename)
+{
+    _utime(filename.c_str(),NULL);
+}
@@ -29,6 +29,7 @@
 #define _DIRECTORIES_H_ 1
 
 #include <string>
+#include <vector>
 
 class PlanningUnit;
 class MultiAgentDecisionProcessInterface;
@@ -54,6 +55,10 @@ namespace ArgumentHandlers { class Arguments; }
  *
  *  MADPGetResultsFilename(...) gives you the concatenated version directly.
  *
+ * Cache files
+ * -----------
+ *  are stored in MADPGetCacheDir (= ~/.madp/cache), see PolicyCache.
+ *
  */
 
 namespace directories {
@@ -108,6 +113,19 @@ namespace directories {
     std::string MADPGetProblemFilename(const std::string &problem);
     std::string MADPGetProblemFilename(const ArgumentHandlers::Arguments &args);
 
+    std::string MADPGetCacheDir();
+    void MADPCreateCacheDir();
+
+    /// Returns the names of the regular files in \a dir.
+    std::vector<std::string> MADPListFiles(const std::string &dir);
+    /// Returns a filename starting with \a base that no other process
+    /// or thread will use.
+    std::string MADPGetUniqueFilename(const std::string &base);
+    /// Renames \a from to \a to, replacing \a to atomically if it exists.
+    bool MADPReplaceFile(const std::string &from, const std::string &to);
+    /// Sets the modification time of \a filename to now.
+    void MADPTouchFile(const std::string &filename);
+
 } // namespace directories
 
 #endif /* !_DIRECTORIES_H_ */
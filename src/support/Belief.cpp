@@ -164,7 +164,8 @@ bool Belief::SanityCheck() const
     return(true);
 }
 
-double Belief::InnerProduct(const vector<double> &values) const
+template <class T>
+double Belief::InnerProductT(const vector<T> &values) const
 {
 #if Belief_CheckAndAbort
     if(!SanityCheck())
@@ -178,6 +179,18 @@ double Belief::InnerProduct(const vector<double> &values) const
     return(x);
 }
 
+double Belief::InnerProduct(const vector<double> &values) const
+{
+    return(InnerProductT(values));
+}
+
+#if MADP_FLOAT_PRECISION
+double Belief::InnerProduct(const vector<float> &values) const
+{
+    return(InnerProductT(values));
+}
+#endif
+
 vector<double> Belief::InnerProduct(const VectorSet &v) const
 {
     vector<double> values(v.size1());
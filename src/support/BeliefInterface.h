@@ -113,6 +113,10 @@ public:
 
     /// Computes the inner product of a belief with the vector \a values.
     virtual double InnerProduct(const std::vector<double> &values) const = 0;
+#if MADP_FLOAT_PRECISION
+    /// Computes the inner product of a belief with the vector \a values.
+    virtual double InnerProduct(const std::vector<float> &values) const = 0;
+#endif
 
     /// Computes the inner product of a belief with the VectorSet \a v.
     /** Returns the inner product with each vector in \a v. */
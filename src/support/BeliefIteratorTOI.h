@@ -0,0 +1,117 @@
+/**\file BeliefIteratorTOI.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _BELIEFITERATORTOI_H_
+#define _BELIEFITERATORTOI_H_ 1
+
+/* the include directives */
+#include "Globals.h"
+#include "BeliefIteratorInterface.h"
+#include "JointBeliefTOI.h"
+
+/** \brief BeliefIteratorTOI is an iterator for factored TOI beliefs.
+ *
+ * It only visits joint states for which every individual state has
+ * a non-zero probability. */
+class BeliefIteratorTOI : public BeliefIteratorInterface
+{
+private:    
+
+    /// The current individual state of each agent.
+    std::vector<Index> _m_sIs;
+    const JointBeliefTOI *_m_belief;
+
+    /// Moves _m_sIs[agentI] to the first non-zero entry from sI on.
+    bool Seek(Index agentI, Index sI)
+        {
+            const std::vector<double> &b=_m_belief->_m_b[agentI];
+            for(; sI<b.size(); ++sI)
+                if(b[sI]!=0)
+                {
+                    _m_sIs[agentI]=sI;
+                    return(true);
+                }
+            return(false);
+        }
+
+protected:
+    
+public:
+
+    // Constructor, destructor and copy assignment.
+    /// (default) Constructor
+    BeliefIteratorTOI(const JointBeliefTOI *b) : 
+        _m_sIs(b->GetNrAgents(),0),
+        _m_belief(b)
+        {
+            for(Index i=0; i!=_m_sIs.size(); ++i)
+                if(!Seek(i,0))
+                    throw(E("BeliefIteratorTOI ctor: belief is empty"));
+        }
+
+    /// Destructor.
+    virtual ~BeliefIteratorTOI(){}
+
+    double GetProbability() const
+        {
+            double p=1;
+            for(Index i=0; i!=_m_sIs.size(); ++i)
+                p*=_m_belief->_m_b[i][_m_sIs[i]];
+            return(p);
+        }
+    Index GetStateIndex() const
+        {
+            Index sI=0;
+            for(Index i=0; i!=_m_sIs.size(); ++i)
+                sI+=_m_sIs[i]*_m_belief->_m_stepSize[i];
+            return(sI);
+        }
+    bool Next()
+        {
+            // the last agent changes fastest, as in IndexTools
+            for(Index i=_m_sIs.size(); i-- > 0; )
+            {
+                if(Seek(i,_m_sIs[i]+1))
+                    return(true);
+                Seek(i,0);
+            }
+            return(false);
+        }
+
+    /// Returns a pointer to a copy of this class.
+    virtual BeliefIteratorTOI* Clone() const
+        { return new BeliefIteratorTOI(*this); }
+
+};
+
+#endif /* !_BELIEFITERATORTOI_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
@@ -204,7 +204,8 @@ bool BeliefSparse::SanityCheck() const
     return(true);
 }
 
-double BeliefSparse::InnerProduct(const vector<double> &values) const
+template <class T>
+double BeliefSparse::InnerProductT(const vector<T> &values) const
 {
 #if BeliefSparse_CheckAndAbort
     if(!SanityCheck())
@@ -217,6 +218,18 @@ double BeliefSparse::InnerProduct(const vector<double> &values) const
     return(x);
 }
 
+double BeliefSparse::InnerProduct(const vector<double> &values) const
+{
+    return(InnerProductT(values));
+}
+
+#if MADP_FLOAT_PRECISION
+double BeliefSparse::InnerProduct(const vector<float> &values) const
+{
+    return(InnerProductT(values));
+}
+#endif
+
 vector<double> BeliefSparse::InnerProduct(const VectorSet &v) const
 {
     vector<double> values(v.size1());
@@ -46,6 +46,10 @@ class BeliefSparse : virtual public BeliefInterface
 {
 private:    
 
+    /// Computes the inner product with values of any scalar type.
+    template <class T>
+    double InnerProductT(const std::vector<T> &values) const;
+
     friend class BeliefIteratorSparse;
 
 protected:
@@ -140,6 +144,9 @@ public:
     bool SanityCheck() const;
 
     double InnerProduct(const std::vector<double> &values) const;
+#if MADP_FLOAT_PRECISION
+    double InnerProduct(const std::vector<float> &values) const;
+#endif
 
     std::vector<double> InnerProduct(const VectorSet &v) const;
 
@@ -76,6 +76,90 @@ IndividualBeliefJESP::IndividualBeliefJESP(Index agentI, Index stage,
     //
     // so we cah the step_size
     _m_stepsizeJOHOH = IndexTools::CalculateStepSize(_m_nrOH_others);
+    _m_nrJOH_others = nrJOH_others;
+
+    //Tables used by Update() and GetJointActionIndex(), such that these
+    //do not need to decompose indices (and allocate vectors) themselves.
+    size_t nrOthers = _m_others.size();
+    _m_othersOHI.resize(nrJOH_others * nrOthers);
+    for(Index johI=0; johI < nrJOH_others; johI++)
+    {
+        const Index* ohIs = IndexTools::JointToIndividualIndicesArrayStepSize(
+            johI, _m_stepsizeJOHOH, nrOthers);
+        for(Index j=0; j < nrOthers; j++)
+            _m_othersOHI[johI*nrOthers + j] = ohIs[j] + _m_pumadp->
+                GetFirstObservationHistoryIndex(_m_others[j], stage);
+        delete [] ohIs;
+    }
+
+    vector<size_t> nrA, nrO, nrO_others;
+    for(Index j=0; j < _m_nrAgents; j++)
+    {
+        nrA.push_back(_m_pumadp->GetNrActions(j));
+        nrO.push_back(_m_pumadp->GetNrObservations(j));
+        if(j != agentI)
+            nrO_others.push_back(_m_pumadp->GetNrObservations(j));
+    }
+    // these match the step sizes used by IndividualToJointActionIndices()
+    // and IndividualToJointObservationIndices()
+    size_t *stepA = IndexTools::CalculateStepSize(nrA);
+    size_t *stepO = IndexTools::CalculateStepSize(nrO);
+    _m_actionStepSize.assign(stepA, stepA + _m_nrAgents);
+    _m_observationStepSize = stepO[agentI];
+
+    _m_nrJO_others = 1;
+    for(Index j=0; j < nrOthers; j++)
+        _m_nrJO_others *= nrO_others[j];
+    _m_othersJOPart.resize(_m_nrJO_others);
+    vector<Index> oIs_others(nrOthers, 0);
+    for(Index JO_o=0; JO_o < _m_nrJO_others; JO_o++)
+    {
+        Index part = 0;
+        for(Index j=0; j < nrOthers; j++)
+            part += oIs_others[j] * stepO[_m_others[j]];
+        _m_othersJOPart[JO_o] = part;
+        IndexTools::Increment(oIs_others, nrO_others);
+    }
+
+    if(stage > 0)
+    {
+        //the others' observation histories of the previous stage
+        size_t nrJOH_prev = 1;
+        vector<size_t> nrOH_prev;
+        for(Index j=0; j < nrOthers; j++)
+        {
+            nrOH_prev.push_back(_m_pumadp->
+                GetNrObservationHistories(_m_others[j], stage-1));
+            nrJOH_prev *= nrOH_prev[j];
+        }
+        _m_successorJOHI.resize(nrJOH_prev * _m_nrJO_others);
+        vector<Index> prev_ohIs(nrOthers, 0);
+        vector<Index> next_ohIs(nrOthers);
+        for(Index prev_johI=0; prev_johI < nrJOH_prev; prev_johI++)
+        {
+            for(Index JO_o=0; JO_o < _m_nrJO_others; JO_o++)
+            {
+                //oIs_others cycles back to all zeros after each prev_johI
+                for(Index j=0; j < nrOthers; j++)
+                {
+                    Index agJ = _m_others[j];
+                    Index prev_ohI = prev_ohIs[j] + _m_pumadp->
+                        GetFirstObservationHistoryIndex(agJ, stage-1);
+                    next_ohIs[j] = _m_pumadp->GetSuccessorOHI(agJ, prev_ohI,
+                                                              oIs_others[j])
+                        - _m_pumadp->GetFirstObservationHistoryIndex(agJ,
+                                                                     stage);
+                }
+                _m_successorJOHI[prev_johI*_m_nrJO_others + JO_o] =
+                    IndexTools::IndividualToJointIndicesStepSize(
+                        next_ohIs, _m_stepsizeJOHOH);
+                IndexTools::Increment(oIs_others, nrO_others);
+            }
+            IndexTools::Increment(prev_ohIs, nrOH_prev);
+        }
+    }
+    delete [] stepA;
+    delete [] stepO;
 }
 
 //Destructor
@@ -100,19 +184,25 @@ IndividualBeliefJESP::operator= (const IndividualBeliefJESP& o)
 vector<Index>
 IndividualBeliefJESP::GetOthersObservationHistIndex(Index eI) const
 {
-    //get <sI, JOHI_others>
-    vector<Index> v1 = 
-        IndexTools::JointToIndividualIndicesStepSize(eI, _m_stepsizeSJOH, 2);
-    //get <individual observation history indices of others:
-    vector<Index> withinStageOHIndices_o = 
-        IndexTools::JointToIndividualIndicesStepSize(
-            v1.at(1), _m_stepsizeJOHOH, _m_nrAgents-1 );
-    //add the offset for the stage to the indices:
+    vector<Index> withinStageOHIndices_o(_m_nrAgents-1);
     for(Index j=0; j < withinStageOHIndices_o.size(); j++)
-        withinStageOHIndices_o[j] += _m_pumadp->
-            GetFirstObservationHistoryIndex( _m_others[j], _m_stage); 
+        withinStageOHIndices_o[j] = GetOthersObservationHistIndex(eI, j);
     return(withinStageOHIndices_o);
 }
+
+Index IndividualBeliefJESP::GetJointActionIndex(Index eI, Index actionI,
+    const JointPolicyPureVector* jpol) const
+{
+    Index jaI = actionI * _m_actionStepSize[_m_agentI];
+    for(Index j=0; j < _m_others.size(); j++)
+    {
+        Index agJ = _m_others[j];
+        jaI += jpol->GetActionIndex(agJ, GetOthersObservationHistIndex(eI, j))
+            * _m_actionStepSize[agJ];
+    }
+    return(jaI);
+}
+
 Index 
 IndividualBeliefJESP::GetAugmentedStateIndex(Index sI, 
         const vector<Index>& oHist_others) const
@@ -137,42 +227,23 @@ double IndividualBeliefJESP::Update(
            Index lastAI, Index newOI, const JointPolicyPureVector* jpol)
 {
     //set all probs of this belief to 0
-    _m_b = vector<double>(_m_b.size(), 0.0);
+    fill(_m_b.begin(), _m_b.end(), 0.0);
 
     double Po_ba = 0.0; // P(o|b,a) with o=newJO
-    vector<double> newJB_unnorm;
-
-    size_t nrJO_others = 1;
-    vector<Index> otherAgentIndices;
-    vector<size_t> nrO_others; 
-    for(Index j=0; j < _m_pumadp->GetNrAgents(); j++)
-    {
-        if(j == _m_agentI)
-            continue;
-        //else
-        Index nrO_j =  _m_pumadp->GetNrObservations(j);
-        nrJO_others *= nrO_j;
-        nrO_others.push_back(nrO_j);
-        otherAgentIndices.push_back(j);
-    }
+    size_t nrS = _m_pumadp->GetNrStates();
+    size_t nrJOH_prev = b_prev._m_nrJOH_others;
+    // `our' observation is fixed
+    Index ownJOPart = newOI * _m_observationStepSize;
 
     for(Index prev_eI=0; prev_eI < b_prev.Size(); prev_eI++)
     {
-        Index prev_sI = b_prev.GetStateIndex(prev_eI);
-        vector<Index> prev_oHist_others = b_prev.
-            GetOthersObservationHistIndex(prev_eI);
-        vector<Index> actions(_m_nrAgents);
-        actions.at(_m_agentI) = lastAI;
-        for(Index j=0; j < otherAgentIndices.size(); j++)
-        {
-            Index ag_j = otherAgentIndices[j];
-            Index prev_oHist_j = prev_oHist_others[j];//not ag_j!!!
-            Index act_j = jpol->GetActionIndex(ag_j, prev_oHist_j);
-            actions.at(ag_j) = act_j;
-        }
-        Index jaI = _m_pumadp->IndividualToJointActionIndices(actions);
+        double b_prev_e = b_prev.Get(prev_eI);
+        Index prev_sI = prev_eI / nrJOH_prev;
+        Index prev_johI = prev_eI % nrJOH_prev;
+        Index jaI = b_prev.GetJointActionIndex(prev_eI, lastAI, jpol);
+        const Index* next_johIs = &_m_successorJOHI[prev_johI*_m_nrJO_others];
 
-        for(Index next_sI=0; next_sI < _m_pumadp->GetNrStates(); next_sI++)
+        for(Index next_sI=0; next_sI < nrS; next_sI++)
         {
             //note we do not loop over all possible next_eI, because *a lot*
             //of transitions will be 0 ( if next_oHistJ != (prev_oHistJ, oJ) )
@@ -180,50 +251,30 @@ double IndividualBeliefJESP::Update(
             //rather we now loop over all possible oJ (observations of others)
             double Ps_as = _m_pumadp->
                 GetTransitionProbability(prev_sI, jaI, next_sI);
+            Index next_eI_base = next_sI * _m_nrJOH_others;
 
-            for(Index JO_o=0; JO_o < nrJO_others; JO_o++)
+            for(Index JO_o=0; JO_o < _m_nrJO_others; JO_o++)
             {
-                vector<Index> oIs(_m_nrAgents);
-                oIs.at(_m_agentI) = newOI; // `our' observation is fixed
-                vector<Index> oIs_others = IndexTools::JointToIndividualIndices(
-                        JO_o, nrO_others);
-                for(Index j=0; j < otherAgentIndices.size(); j++)
-                    oIs.at( otherAgentIndices.at(j) ) = oIs_others.at(j);
-
-                Index joI = _m_pumadp->IndividualToJointObservationIndices(oIs);
+                Index joI = ownJOPart + _m_othersJOPart[JO_o];
                 //compute P(joI | jaI,s')
                 double Po_as = _m_pumadp->GetObservationProbability(
                         jaI, next_sI, joI);
                 
                 //prob of next_eI = <next_sI, (oHist_others, oIs_others)>
-                //AND prev_sI can now be computed.
-                //
-                //first, however, lets find the index, next_eI, for 
-                // <next_sI, (oHist_others, oIs_others)>
-                
-                // first find the next_oHist_others indices.
-                vector<Index> next_oHist_others;
-                for(Index j=0; j < otherAgentIndices.size(); j++)
-                {
-                    Index next_oHist_j = _m_pumadp->GetSuccessorOHI(j, 
-                        prev_oHist_others[j], oIs_others[j] );
-                    next_oHist_others.push_back(next_oHist_j);
-                }
-                Index next_eI = GetAugmentedStateIndex(next_sI, 
-                        next_oHist_others);
+                Index next_eI = next_eI_base + next_johIs[JO_o];
 
                 //p += P(oi | ai, <s',oH'>) * P(<s',oH'>|<s,oH>,ai) * b(<s,oH>)
                 //      = P(oi, <s',oH'>|<s,oH'>,ai) * b(<s,oH>)
                 //      = P(s', jo | s, ja) b(<s,oH>)  //ja=<ai, aj>,aj=pol(oHj)
                 //      = P(jo|ja,s')*P(s'|s,ja)
-                double Pso_sa =  Po_as * Ps_as * b_prev.Get(prev_eI);
-                _m_b.at(next_eI) += Pso_sa;
+                double Pso_sa =  Po_as * Ps_as * b_prev_e;
+                _m_b[next_eI] += Pso_sa;
                 Po_ba += Pso_sa; //running sum of P(oi|b,ai)
             }
         }
     }
     for(Index eI=0; eI < this->Size(); eI++)
-        _m_b.at(eI) = _m_b.at(eI) / Po_ba;
+        _m_b[eI] = _m_b[eI] / Po_ba;
 
     return(Po_ba);
 
@@ -67,6 +67,26 @@ private:
     size_t * _m_stepsizeSJOH;
     ///the step-size cache for joHistJ <-> <oHist1,...oHistnrA> conversion
     size_t * _m_stepsizeJOHOH;
+
+    ///The number of joint observation histories of the others.
+    size_t _m_nrJOH_others;
+    ///The number of joint observations of the others.
+    size_t _m_nrJO_others;
+    ///The observation history indices of the others, for each joHistJ.
+    /**_m_othersOHI[johI*(nrAgents-1) + j] is the (stage-offset) index of
+     * the observation history of the j-th other agent in joHistJ johI.*/
+    std::vector<Index> _m_othersOHI;
+    ///The step sizes of the agents in a joint action index.
+    std::vector<size_t> _m_actionStepSize;
+    ///The step size of _m_agentI in a joint observation index.
+    size_t _m_observationStepSize;
+    ///The part of the joint observation index due to the others' joint obs.
+    std::vector<Index> _m_othersJOPart;
+    ///The joHistJ of this stage that follows joHistJ of the previous stage.
+    /**_m_successorJOHI[prev_johI*_m_nrJO_others + jo_others] is the joHistJ
+     * reached from prev_johI after the others receive jo_others. Empty
+     * for stage 0.*/
+    std::vector<Index> _m_successorJOHI;
     
 protected:
     
@@ -97,6 +117,15 @@ public:
     Index GetStateIndex(Index eI) const;
     ///Get the vector with others' observation history indices cor.to eI
     std::vector<Index> GetOthersObservationHistIndex(Index eI) const;
+    ///Get the observation history index of the j-th other agent in eI.
+    /**This is the non-allocating version of
+     * GetOthersObservationHistIndex(Index eI).*/
+    Index GetOthersObservationHistIndex(Index eI, Index j) const
+    { return(_m_othersOHI[(eI % _m_nrJOH_others)*(_m_nrAgents-1) + j]); }
+    ///Get the joint action taken at augmented state eI.
+    /**The action of _m_agentI is \a actionI, the others follow \a jpol.*/
+    Index GetJointActionIndex(Index eI, Index actionI,
+                              const JointPolicyPureVector* jpol) const;
     //
     Index GetAugmentedStateIndex(Index sI, 
             const std::vector<Index>& oHist_others) const;
@@ -111,9 +140,8 @@ inline
 Index
 IndividualBeliefJESP::GetStateIndex(Index eI) const
 {
-    std::vector<Index> v = 
-        IndexTools::JointToIndividualIndicesStepSize(eI, _m_stepsizeSJOH, 2);
-    return v.at(0);
+    // eI = sI * _m_nrJOH_others + joHistJ, see _m_stepsizeSJOH
+    return(eI / _m_nrJOH_others);
 }
 
 
@@ -0,0 +1,404 @@
+/**\file JointBeliefTOI.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include "JointBeliefTOI.h"
+#include "BeliefIteratorTOI.h"
+#include "BeliefIteratorGeneric.h"
+#include "IndexTools.h"
+#include "StateDistribution.h"
+#include "TOIDecPOMDPDiscrete.h"
+#include <float.h>
+
+using namespace std;
+
+//Necessary as header file contains a forward declaration:
+#include "MultiAgentDecisionProcessDiscreteInterface.h" 
+
+#define JointBeliefTOI_doSanityCheckAfterEveryUpdate 0
+
+JointBeliefTOI::JointBeliefTOI(const vector<size_t> &nrStates) :
+    _m_nrStates(nrStates),
+    _m_stepSize(IndexTools::CalculateStepSize(nrStates)),
+    _m_b(nrStates.size())
+{
+    for(Index i=0; i!=_m_nrStates.size(); ++i)
+        _m_b[i].assign(_m_nrStates[i],0);
+}
+
+JointBeliefTOI::JointBeliefTOI(const JointBeliefTOI &o) :
+    _m_nrStates(o._m_nrStates),
+    _m_stepSize(IndexTools::CalculateStepSize(o._m_nrStates)),
+    _m_b(o._m_b)
+{
+}
+
+//Destructor
+JointBeliefTOI::~JointBeliefTOI()
+{
+    delete [] _m_stepSize;
+}
+
+JointBeliefTOI& 
+JointBeliefTOI::operator= (const JointBeliefTOI& o)
+{
+    if (this == &o) return *this;   // Gracefully handle self assignment
+    // Put the normal assignment duties here...
+    if(_m_nrStates!=o._m_nrStates)
+    {
+        delete [] _m_stepSize;
+        _m_nrStates=o._m_nrStates;
+        _m_stepSize=IndexTools::CalculateStepSize(_m_nrStates);
+    }
+    _m_b=o._m_b;
+    return *this;
+}
+
+JointBeliefInterface& 
+JointBeliefTOI::operator= (const JointBeliefInterface& o)
+{
+    if (this == &o) return *this;   // Gracefully handle self assignment
+    const JointBeliefTOI& casted_o = 
+        dynamic_cast<const JointBeliefTOI&>(o);
+    return(operator=(casted_o));// call the operator= for JointBeliefTOI
+}
+
+BeliefInterface& 
+JointBeliefTOI::operator= (const BeliefInterface& o)
+{
+    if (this == &o) return *this;   // Gracefully handle self assignment
+    const JointBeliefTOI& casted_o = 
+        dynamic_cast<const JointBeliefTOI&>(o);
+    return(operator=(casted_o));// call the operator= for JointBeliefTOI
+}
+
+double& JointBeliefTOI::operator[] (Index& i)
+{
+    throw(E("JointBeliefTOI::operator[] joint probabilities are not stored"));
+}
+
+double& JointBeliefTOI::operator[] (int& i)
+{
+    throw(E("JointBeliefTOI::operator[] joint probabilities are not stored"));
+}
+
+void JointBeliefTOI::SetMarginals(const vector<double> &belief)
+{
+    if(belief.size()!=Size())
+        throw(E("JointBeliefTOI::SetMarginals belief has the wrong size"));
+
+    Clear();
+    Index* sIs=(Index*)_alloca(GetNrAgents()*sizeof(Index));
+    for(Index sI=0; sI!=belief.size(); ++sI)
+    {
+        if(belief[sI]==0)
+            continue;
+        IndexTools::JointToIndividualIndicesArrayStepSize(sI, _m_stepSize,
+                                                          GetNrAgents(), sIs);
+        for(Index i=0; i!=GetNrAgents(); ++i)
+            _m_b[i][sIs[i]]+=belief[sI];
+    }
+}
+
+void JointBeliefTOI::Set(const StateDistribution& belief)
+{
+    SetMarginals(belief.ToVectorOfDoubles());
+}
+
+void JointBeliefTOI::Set(const vector<double> &belief)
+{
+    SetMarginals(belief);
+}
+
+void JointBeliefTOI::Set(const BeliefInterface &belief)
+{
+    const JointBeliefTOI *b;
+    if((b=dynamic_cast<const JointBeliefTOI*>( &belief )))
+    {
+        operator=(*b);
+        return;
+    }
+
+    if(belief.Size()!=Size())
+        throw(E("JointBeliefTOI::Set belief has the wrong size"));
+
+    Clear();
+    Index* sIs=(Index*)_alloca(GetNrAgents()*sizeof(Index));
+    BeliefIteratorGeneric it=belief.GetIterator();
+    do
+    {
+        IndexTools::JointToIndividualIndicesArrayStepSize(it.GetStateIndex(),
+                                                          _m_stepSize,
+                                                          GetNrAgents(), sIs);
+        for(Index i=0; i!=GetNrAgents(); ++i)
+            _m_b[i][sIs[i]]+=it.GetProbability();
+    }
+    while(it.Next());
+}
+
+void JointBeliefTOI::Set(Index sI, double prob)
+{
+    throw(E("JointBeliefTOI::Set(sI,prob) joint probabilities are not stored"));
+}
+
+void JointBeliefTOI::SetIndividualBelief(Index agentI, const vector<double> &b)
+{
+    if(b.size()!=_m_nrStates.at(agentI))
+        throw(E("JointBeliefTOI::SetIndividualBelief belief has the wrong size"));
+    _m_b[agentI]=b;
+}
+
+void JointBeliefTOI::SetFromISD(
+    const TransitionObservationIndependentMADPDiscrete &toi)
+{
+    if(toi.GetNrAgents()!=GetNrAgents())
+        throw(E("JointBeliefTOI::SetFromISD wrong number of agents"));
+    for(Index i=0; i!=GetNrAgents(); ++i)
+        SetIndividualBelief(i, toi.GetIndividualMADPD(i)->GetISD()->
+                            ToVectorOfDoubles());
+}
+
+double JointBeliefTOI::Get(Index sI) const
+{
+    double p=1;
+    for(Index i=0; i!=GetNrAgents(); ++i)
+    {
+        p*=_m_b[i][sI/_m_stepSize[i]];
+        sI%=_m_stepSize[i];
+    }
+    return(p);
+}
+
+vector<double> JointBeliefTOI::Get() const
+{
+    vector<double> b(Size(),0);
+    if(b.empty())
+        return(b);
+    BeliefIteratorTOI it(this);
+    do
+        b[it.GetStateIndex()]=it.GetProbability();
+    while(it.Next());
+    return(b);
+}
+
+void JointBeliefTOI::Clear()
+{
+    for(Index i=0; i!=GetNrAgents(); ++i)
+        _m_b[i].assign(_m_nrStates[i],0);
+}
+
+string JointBeliefTOI::SoftPrint() const
+{
+    stringstream ss;
+    for(Index i=0; i!=GetNrAgents(); ++i)
+        ss << "b_" << i << " " << SoftPrintVector(_m_b[i]) << endl;
+    return(ss.str());
+}
+
+unsigned int JointBeliefTOI::Size() const
+{
+    unsigned int size=1;
+    for(Index i=0; i!=GetNrAgents(); ++i)
+        size*=_m_nrStates[i];
+    return(size);
+}
+
+bool JointBeliefTOI::SanityCheck() const
+{
+    if(GetNrAgents()==0)
+        return(false);
+
+    for(Index i=0; i!=GetNrAgents(); ++i)
+    {
+        // check for negative and entries>1
+        double sum=0;
+        for(vector<double>::const_iterator it=_m_b[i].begin();
+            it!=_m_b[i].end(); ++it)
+        {
+            if(*it<0)
+                return(false);
+            if(*it>1)
+                return(false);
+            if(_isnan(*it))
+                return(false);
+            sum+=*it;
+        }
+
+        // check if sums to 1
+        if(abs(sum-1)>PROB_PRECISION)
+            return(false);
+
+        // check whether the size is not zero
+        if(_m_b[i].size()==0)
+            return(false);
+    }
+
+    // if we haven't returned yet, the belief is fine
+    return(true);
+}
+
+template <class T>
+double JointBeliefTOI::InnerProductT(const vector<T> &values) const
+{
+    double x=0;
+    BeliefIteratorTOI it(this);
+    do
+        x+=it.GetProbability()*values[it.GetStateIndex()];
+    while(it.Next());
+
+    return(x);
+}
+
+double JointBeliefTOI::InnerProduct(const vector<double> &values) const
+{
+    return(InnerProductT(values));
+}
+
+#if MADP_FLOAT_PRECISION
+double JointBeliefTOI::InnerProduct(const vector<float> &values) const
+{
+    return(InnerProductT(values));
+}
+#endif
+
+vector<double> JointBeliefTOI::InnerProduct(const VectorSet &v) const
+{
+    vector<double> values(v.size1(),0);
+
+    BeliefIteratorTOI it(this);
+    do
+    {
+        double p=it.GetProbability();
+        Index sI=it.GetStateIndex();
+        for(unsigned int k=0;k!=v.size1();++k)
+            values[k]+=p*v(k,sI);
+    }
+    while(it.Next());
+
+    return(values);
+}
+
+vector<double> JointBeliefTOI::InnerProduct(const VectorSet &v,
+                                            const vector<bool> &mask) const
+{
+    vector<double> values(v.size1(),-DBL_MAX);
+    for(unsigned int k=0;k!=v.size1();++k)
+        if(mask[k])
+            values[k]=0;
+
+    BeliefIteratorTOI it(this);
+    do
+    {
+        double p=it.GetProbability();
+        Index sI=it.GetStateIndex();
+        for(unsigned int k=0;k!=v.size1();++k)
+            if(mask[k])
+                values[k]+=p*v(k,sI);
+    }
+    while(it.Next());
+
+    return(values);
+}
+
+BeliefIteratorGeneric JointBeliefTOI::GetIterator() const
+{
+    return(BeliefIteratorGeneric(new BeliefIteratorTOI(this)));
+}
+
+double JointBeliefTOI::Update(
+    const MultiAgentDecisionProcessDiscreteInterface &pu,
+    Index lastJAI, Index newJOI)
+{
+    const TransitionObservationIndependentMADPDiscrete *toi=
+        dynamic_cast<const TransitionObservationIndependentMADPDiscrete*>(&pu);
+    if(toi==0)
+        throw(E("JointBeliefTOI::Update requires a transition observation independent model"));
+
+    Index* aIs=(Index*)_alloca(GetNrAgents()*sizeof(Index));
+    Index* oIs=(Index*)_alloca(GetNrAgents()*sizeof(Index));
+    toi->JointToIndividualActionIndices(lastJAI, aIs);
+    toi->JointToIndividualObservationIndices(newJOI, oIs);
+
+    // P(o|b,a) factors as well, as each agent only observes its own state
+    double Po_ba = 1.0;
+    for(Index i=0; i!=GetNrAgents(); ++i)
+        Po_ba*=UpdateIndividual(*toi->GetIndividualMADPD(i),
+                                i, aIs[i], oIs[i]);
+
+#if JointBeliefTOI_doSanityCheckAfterEveryUpdate
+    if(!SanityCheck())
+        throw(E("JointBeliefTOI::Update SanityCheck failed"));
+#endif
+
+    return(Po_ba);
+}
+
+double JointBeliefTOI::UpdateIndividual(
+    const MultiAgentDecisionProcessDiscrete &madp,
+    Index agentI, Index aI, Index oI)
+{
+    const vector<double> &b=_m_b[agentI];
+    size_t nrS = b.size();
+    vector<double> newB_unnorm(nrS,0);
+    double Po_ba = 0.0; // P(o|b,a) with o=oI
+    double Ps_ba, Po_as, Pso_ba;
+    for(Index sI=0; sI < nrS; sI++)
+    {
+        //P(sI | b, a) = sum_(prec_s) P(sI | prec_s, a)*B(prec_s)
+        Ps_ba = 0.0;
+        for(Index prevSI=0; prevSI < nrS; prevSI++)
+            if(b[prevSI]!=0)
+                Ps_ba += madp.GetTransitionProbability(prevSI, aI, sI) *
+                    b[prevSI];
+
+        if(Ps_ba>0) // if it is zero, Pso_ba will be zero anyway
+        {
+            //P(oI | aI, sI) :
+            Po_as = madp.GetObservationProbability(aI, sI, oI);
+
+            //the new (unormalized) belief P(s,o|b,a)
+            Pso_ba = Po_as * Ps_ba;
+            newB_unnorm[sI] = Pso_ba;
+            Po_ba += Pso_ba; //running sum of P(o|b,a)
+        }
+    }
+
+    //normalize:
+    if(Po_ba>0)
+        for(Index sI=0; sI < nrS; sI++)
+            newB_unnorm[sI]/=Po_ba;
+
+    _m_b[agentI].swap(newB_unnorm);
+
+    return(Po_ba);
+}
+
+double JointBeliefTOI::GetExpectedReward(const TOIDecPOMDPDiscrete &toi,
+                                         Index jaI) const
+{
+    return(toi.GetExpectedReward(_m_b, toi.JointToIndividualActionIndices(jaI)));
+}
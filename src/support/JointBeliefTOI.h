@@ -0,0 +1,175 @@
+/**\file JointBeliefTOI.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _JOINTBELIEFTOI_H_
+#define _JOINTBELIEFTOI_H_ 1
+
+/* the include directives */
+#include <iostream>
+#include "Globals.h"
+#include "JointBeliefInterface.h"
+
+class MultiAgentDecisionProcessDiscreteInterface;
+class MultiAgentDecisionProcessDiscrete;
+class TransitionObservationIndependentMADPDiscrete;
+class TOIDecPOMDPDiscrete;
+class BeliefIteratorTOI;
+
+/**\brief JointBeliefTOI represents a joint belief for transition
+ * observation independent models as a product of individual beliefs.
+ *
+ * When transitions and observations are independent and the initial
+ * state distribution is a product of individual distributions, the
+ * joint belief remains a product of the individual beliefs. Update()
+ * therefore updates each factor using the individual model of the
+ * corresponding agent, which costs sum_i |S_i|^2 instead of
+ * (prod_i |S_i|)^2. The flat joint belief is never stored: Get(sI)
+ * multiplies the factors, and GetExpectedReward() uses the reward
+ * structure of TOIDecPOMDPDiscrete to avoid enumerating joint states.
+ *
+ * Because the joint probabilities are not stored, operator[] and
+ * Set(sI,prob) are not supported. Setting the belief from a joint
+ * distribution keeps only its marginals, which is exact for product
+ * distributions.
+ */
+class JointBeliefTOI : public JointBeliefInterface
+{
+private:    
+
+    /// Computes the inner product with values of any scalar type.
+    template <class T>
+    double InnerProductT(const std::vector<T> &values) const;
+
+    friend class BeliefIteratorTOI;
+
+    /// The number of individual states of each agent.
+    std::vector<size_t> _m_nrStates;
+    /// Step sizes to convert between joint and individual state indices.
+    size_t * _m_stepSize;
+    /// The belief of each agent over its individual states.
+    std::vector<std::vector<double> > _m_b;
+
+    /// Sets the marginals from a joint distribution \a belief.
+    void SetMarginals(const std::vector<double> &belief);
+
+    /// Updates the belief of agentI, returns P(oI|b_i,aI).
+    double UpdateIndividual(const MultiAgentDecisionProcessDiscrete &madp,
+                            Index agentI, Index aI, Index oI);
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructor which sets the number of individual states per agent.
+    JointBeliefTOI(const std::vector<size_t> &nrStates);
+    /// Copy constructor.
+    JointBeliefTOI(const JointBeliefTOI &o);
+    /// Destructor.
+    ~JointBeliefTOI();
+
+    JointBeliefTOI& operator= (const JointBeliefTOI& o);
+    JointBeliefInterface& operator= (const JointBeliefInterface& o);
+    BeliefInterface& operator= (const BeliefInterface& o);
+
+    // operators:
+    double& operator[] (Index& i);
+    double& operator[] (int& i);
+
+    //data manipulation (set) functions:
+
+    void Set(const StateDistribution& belief);
+    void Set(const std::vector<double> &belief);
+    void Set(const BeliefInterface &belief);
+    void Set(Index sI, double prob);
+
+    /// Sets the belief of agentI over its individual states.
+    void SetIndividualBelief(Index agentI, const std::vector<double> &b);
+
+    /// Sets each factor to the individual initial state distribution.
+    void SetFromISD(const TransitionObservationIndependentMADPDiscrete &toi);
+
+    //get (data) functions:
+
+    double Get(Index sI) const;
+    /// Returns the flat joint belief, which has prod_i |S_i| entries.
+    std::vector<double> Get() const;
+
+    /// Returns the belief of agentI over its individual states.
+    const std::vector<double>& GetIndividualBelief(Index agentI) const
+        { return(_m_b.at(agentI)); }
+
+    /// Returns the number of agents (factors).
+    size_t GetNrAgents() const { return(_m_nrStates.size()); }
+
+    void Clear();
+
+    std::string SoftPrint() const;
+
+    void Print() const { std::cout << SoftPrint(); }
+
+    unsigned int Size() const;
+
+    bool SanityCheck() const;
+
+    double InnerProduct(const std::vector<double> &values) const;
+#if MADP_FLOAT_PRECISION
+    double InnerProduct(const std::vector<float> &values) const;
+#endif
+
+    std::vector<double> InnerProduct(const VectorSet &v) const;
+
+    std::vector<double> InnerProduct(const VectorSet &v,
+                                     const std::vector<bool> &mask) const;
+
+    BeliefIteratorGeneric GetIterator() const;
+
+    /**\brief Updates the factors, \a pu should be a
+     * TransitionObservationIndependentMADPDiscrete.
+     *
+     * Returns P(newJOI|b,lastJAI), the product of the individual
+     * observation probabilities. */
+    double Update(const MultiAgentDecisionProcessDiscreteInterface &pu,
+                  Index lastJAI, Index newJOI);
+
+    /// Returns the expected reward of joint action \a jaI.
+    double GetExpectedReward(const TOIDecPOMDPDiscrete &toi,
+                             Index jaI) const;
+
+    /// Returns a pointer to a copy of this class.
+    virtual JointBeliefTOI* Clone() const
+        { return new JointBeliefTOI(*this); }
+
+};
+
+
+#endif /* !_JOINTBELIEFTOI_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
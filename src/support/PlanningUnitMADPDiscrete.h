@@ -369,7 +369,7 @@ public:
     /**\brief Returns a _new_ joint belief with the value of the
      * initial state distribution.
      */
-    JointBeliefInterface* GetNewJointBeliefFromISD() const;
+    virtual JointBeliefInterface* GetNewJointBeliefFromISD() const;
 
     /// Get the parameters for this planning unit.
     const PlanningUnitMADPDiscreteParameters& GetParams() const 
@@ -413,6 +413,10 @@ public:
     /** \brief Returns a vector containing the indices of the
      * indiv. actions corresponding to the joint action jaI.*/
     std::vector<Index> JointToIndividualActionIndices(Index jaI) const;
+    /** \brief Writes the indices of the indiv. actions corresponding
+     * to the joint action jaI to AI_ar (of size GetNrAgents()).*/
+    void JointToIndividualActionIndices(Index jaI, Index* AI_ar) const
+        {GetReferred()->JointToIndividualActionIndices(jaI, AI_ar);}
  
 
     //related to getting (info of) observations
@@ -442,6 +446,11 @@ public:
      * joI.*/
     std::vector<Index> JointToIndividualObservationIndices(Index joI) const
         {return(GetReferred()->JointToIndividualObservationIndices(joI));}
+    /** \brief Writes the indices of the indiv. observations
+     * corresponding to the joint observation joI to OI_ar (of size
+     * GetNrAgents()).*/
+    void JointToIndividualObservationIndices(Index joI, Index* OI_ar) const
+        {GetReferred()->JointToIndividualObservationIndices(joI, OI_ar);}
    
     //related to getting histories: 
     /**This function computes the index of a history.
@@ -40,6 +40,7 @@ PlanningUnitMADPDiscreteParameters::PlanningUnitMADPDiscreteParameters()
     _m_jointActionObservationHistories=true;
     _m_JointBeliefs=true;
     _m_useSparseBeliefs=false;
+    _m_useTOIBeliefs=false;
 }
 
 //Destructor
@@ -104,6 +105,9 @@ void PlanningUnitMADPDiscreteParameters::Print() const
 
     cout << "UseSparseJointBeliefs: "
          << GetUseSparseJointBeliefs() << endl;
+
+    cout << "UseTOIJointBeliefs: "
+         << GetUseTOIJointBeliefs() << endl;
 }
 
 void PlanningUnitMADPDiscreteParameters::SanityCheck() const
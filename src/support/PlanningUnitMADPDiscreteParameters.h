@@ -70,6 +70,8 @@ private:
     bool _m_JointBeliefs;
     /// Use sparse beliefs or the full representation.
     bool _m_useSparseBeliefs;
+    /// Use factored beliefs (JointBeliefTOI) for TOI models.
+    bool _m_useTOIBeliefs;
 
 
 
@@ -143,6 +145,14 @@ public:
         _m_useSparseBeliefs = val; 
     }
 
+    /**\brief Switch on or off whether joint beliefs of transition
+     * observation independent models should be factored per agent.
+     *
+     * Only used by PlanningUnitTOIDecPOMDPDiscrete, see JointBeliefTOI. */
+    void SetUseTOIJointBeliefs(bool val){
+        _m_useTOIBeliefs = val; 
+    }
+
     /// Are individual observation histories generated or not.
     bool GetComputeIndividualObservationHistories() const{
         return(_m_individualObservationHistories);
@@ -183,6 +193,11 @@ public:
         return(_m_useSparseBeliefs);
     }
 
+    /// Are factored beliefs used for TOI models or not.
+    bool GetUseTOIJointBeliefs() const{
+        return(_m_useTOIBeliefs);
+    }
+
     /// Print out the parameters to cout.
     void Print() const;
 
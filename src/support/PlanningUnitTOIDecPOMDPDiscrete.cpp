@@ -26,6 +26,7 @@
  */
 
 #include "PlanningUnitTOIDecPOMDPDiscrete.h"
+#include "JointBeliefTOI.h"
 
 using namespace std;
 
@@ -77,3 +78,30 @@ bool PlanningUnitTOIDecPOMDPDiscrete::SanityCheck() const
     return(sane);
 }
 
+JointBeliefInterface*
+PlanningUnitTOIDecPOMDPDiscrete::GetNewJointBeliefInterface() const
+{
+    if(GetParams().GetUseTOIJointBeliefs())
+    {
+        vector<size_t> nrStates(GetNrAgents());
+        for(Index i=0;i!=GetNrAgents();++i)
+            nrStates[i]=GetReferred()->GetNrStates(i);
+        return(new JointBeliefTOI(nrStates));
+    }
+    else
+        return(PlanningUnitMADPDiscrete::GetNewJointBeliefInterface());
+}
+
+JointBeliefInterface*
+PlanningUnitTOIDecPOMDPDiscrete::GetNewJointBeliefFromISD() const
+{
+    if(GetParams().GetUseTOIJointBeliefs())
+    {
+        JointBeliefTOI* b0=
+            static_cast<JointBeliefTOI*>(GetNewJointBeliefInterface());
+        b0->SetFromISD(*GetReferred());
+        return(b0);
+    }
+    else
+        return(PlanningUnitMADPDiscrete::GetNewJointBeliefFromISD());
+}
@@ -85,7 +85,7 @@ public:
 
     /**\brief returns a vector of individual (local) state indices
      * corresponding to joint state index jointSI.*/
-    const std::vector<Index>& JointToIndividualStateIndices(Index jointSI) const
+    std::vector<Index> JointToIndividualStateIndices(Index jointSI) const
         { return(GetReferred()->JointToIndividualStateIndices(jointSI)); }
 
     /**\brief returns the joint index for indivStateIndices*/
@@ -106,6 +106,16 @@ public:
     std::vector<Index> SampleInitialStates(void) const
         { return(GetReferred()->SampleInitialStates()); }
 
+    using PlanningUnitMADPDiscrete::GetNewJointBeliefInterface;
+    /**\brief Returns a new JointBeliefTOI when
+     * GetUseTOIJointBeliefs() is set, otherwise behaves as
+     * PlanningUnitMADPDiscrete::GetNewJointBeliefInterface(). */
+    JointBeliefInterface* GetNewJointBeliefInterface() const;
+    /**\brief When GetUseTOIJointBeliefs() is set, the factors are
+     * initialized from the individual initial state distributions, so
+     * no joint ISD is needed. */
+    JointBeliefInterface* GetNewJointBeliefFromISD() const;
+
 };
 
 
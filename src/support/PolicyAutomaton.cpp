@@ -0,0 +1,300 @@
+/**\file PolicyAutomaton.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include "PolicyAutomaton.h"
+#include <fstream>
+#include <sstream>
+#include "E.h"
+#include "JointPolicyPureVector.h"
+#include "PlanningUnitMADPDiscrete.h"
+#include "Action.h"
+#include "Observation.h"
+
+using namespace std;
+
+/// Identifies a PolicyAutomaton file (and its format version).
+static const char PolicyAutomaton_Magic[8]={'M','A','D','P','P','A','0','1'};
+
+static void WriteIndex(ofstream &fp, Index i)
+{
+    fp.write(reinterpret_cast<const char*>(&i),sizeof(Index));
+}
+
+static Index ReadIndex(ifstream &fp)
+{
+    Index i;
+    fp.read(reinterpret_cast<char*>(&i),sizeof(Index));
+    if(!fp)
+        throw(E("PolicyAutomaton: unexpected end of file"));
+    return(i);
+}
+
+static void WriteNames(ofstream &fp, const vector<string> &names)
+{
+    WriteIndex(fp,names.size());
+    for(Index i=0;i!=names.size();++i)
+    {
+        WriteIndex(fp,names[i].size());
+        fp.write(names[i].data(),names[i].size());
+    }
+}
+
+static vector<string> ReadNames(ifstream &fp)
+{
+    vector<string> names(ReadIndex(fp));
+    for(Index i=0;i!=names.size();++i)
+    {
+        names[i].resize(ReadIndex(fp));
+        if(!names[i].empty())
+            fp.read(&names[i][0],names[i].size());
+    }
+    if(!fp)
+        throw(E("PolicyAutomaton: unexpected end of file"));
+    return(names);
+}
+
+static void WriteIndices(ofstream &fp, const vector<Index> &v)
+{
+    WriteIndex(fp,v.size());
+    if(!v.empty())
+        fp.write(reinterpret_cast<const char*>(&v[0]),
+                 v.size()*sizeof(Index));
+}
+
+static vector<Index> ReadIndices(ifstream &fp)
+{
+    vector<Index> v(ReadIndex(fp));
+    if(!v.empty())
+        fp.read(reinterpret_cast<char*>(&v[0]),v.size()*sizeof(Index));
+    if(!fp)
+        throw(E("PolicyAutomaton: unexpected end of file"));
+    return(v);
+}
+
+PolicyAutomaton::PolicyAutomaton()
+{
+}
+
+PolicyAutomaton::PolicyAutomaton(const JointPolicyPureVector &jpol,
+                                 const PlanningUnitMADPDiscrete &pu)
+{
+    if(jpol.GetIndexDomainCategory()!=PolicyGlobals::OHIST_INDEX)
+        throw(E("PolicyAutomaton: only policies over observation histories can be compiled"));
+
+    size_t nrAgents=pu.GetNrAgents(),
+        h=pu.GetHorizon();
+    SetNames(pu);
+    _m_actions.resize(nrAgents);
+    _m_successors.resize(nrAgents);
+
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+    {
+        size_t nrO=pu.GetNrObservations(agentI),
+            nrOH=pu.GetNrObservationHistories(agentI);
+
+        _m_actions[agentI].resize(nrOH);
+        _m_successors[agentI].resize(nrOH*nrO,GetRootNode());
+        for(Index ohI=0;ohI!=nrOH;++ohI)
+        {
+            _m_actions[agentI][ohI]=jpol.GetActionIndex(agentI,ohI);
+            // the last stage starts over at the root
+            if(pu.GetTimeStepForOHI(agentI,ohI)+1<h)
+                for(Index oI=0;oI!=nrO;++oI)
+                    _m_successors[agentI][ohI*nrO+oI]=
+                        pu.GetSuccessorOHI(agentI,ohI,oI);
+        }
+    }
+
+    CheckIntegrity();
+}
+
+PolicyAutomaton::PolicyAutomaton(const PlanningUnitMADPDiscrete &pu,
+                                 const vector<vector<Index> > &actions,
+                                 const vector<vector<Index> > &successors) :
+    _m_actions(actions),
+    _m_successors(successors)
+{
+    SetNames(pu);
+    CheckIntegrity();
+}
+
+void PolicyAutomaton::SetNames(const PlanningUnitMADPDiscrete &pu)
+{
+    size_t nrAgents=pu.GetNrAgents();
+    _m_actionNames.assign(nrAgents,vector<string>());
+    _m_observationNames.assign(nrAgents,vector<string>());
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+    {
+        for(Index aI=0;aI!=pu.GetNrActions(agentI);++aI)
+            _m_actionNames[agentI].push_back(pu.GetAction(agentI,aI)->
+                                             GetName());
+        for(Index oI=0;oI!=pu.GetNrObservations(agentI);++oI)
+            _m_observationNames[agentI].push_back(pu.GetObservation(agentI,oI)->
+                                                  GetName());
+    }
+}
+
+void PolicyAutomaton::CheckIntegrity() const
+{
+    size_t nrAgents=_m_actions.size();
+    if(_m_actionNames.size()!=nrAgents ||
+       _m_observationNames.size()!=nrAgents ||
+       _m_successors.size()!=nrAgents)
+        throw(E("PolicyAutomaton: inconsistent number of agents"));
+
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+    {
+        size_t nrNodes=_m_actions[agentI].size();
+        stringstream ss;
+        ss << "PolicyAutomaton: corrupt automaton for agent " << agentI;
+        if(nrNodes==0 ||
+           _m_successors[agentI].size()!=nrNodes*GetNrObservations(agentI))
+            throw(E(ss));
+        for(Index n=0;n!=nrNodes;++n)
+            if(_m_actions[agentI][n]>=GetNrActions(agentI))
+                throw(E(ss));
+        for(Index i=0;i!=_m_successors[agentI].size();++i)
+            if(_m_successors[agentI][i]>=nrNodes)
+                throw(E(ss));
+    }
+}
+
+Index PolicyAutomaton::GetActionIndex(Index agentI,
+                                      const string &name) const
+{
+    for(Index aI=0;aI!=GetNrActions(agentI);++aI)
+        if(_m_actionNames[agentI][aI]==name)
+            return(aI);
+
+    stringstream ss;
+    ss << "PolicyAutomaton::GetActionIndex: agent " << agentI
+       << " has no action " << name;
+    throw(E(ss));
+}
+
+Index PolicyAutomaton::GetObservationIndex(Index agentI,
+                                           const string &name) const
+{
+    for(Index oI=0;oI!=GetNrObservations(agentI);++oI)
+        if(_m_observationNames[agentI][oI]==name)
+            return(oI);
+
+    stringstream ss;
+    ss << "PolicyAutomaton::GetObservationIndex: agent " << agentI
+       << " has no observation " << name;
+    throw(E(ss));
+}
+
+void PolicyAutomaton::Save(const string &filename) const
+{
+    ofstream fp(filename.c_str(),ios::out | ios::binary);
+    if(!fp)
+    {
+        stringstream ss;
+        ss << "PolicyAutomaton::Save: failed to open file " << filename;
+        throw(E(ss));
+    }
+
+    fp.write(PolicyAutomaton_Magic,sizeof(PolicyAutomaton_Magic));
+    WriteIndex(fp,GetNrAgents());
+    for(Index agentI=0;agentI!=GetNrAgents();++agentI)
+    {
+        WriteNames(fp,_m_actionNames[agentI]);
+        WriteNames(fp,_m_observationNames[agentI]);
+        WriteIndices(fp,_m_actions[agentI]);
+        WriteIndices(fp,_m_successors[agentI]);
+    }
+
+    if(!fp)
+    {
+        stringstream ss;
+        ss << "PolicyAutomaton::Save: failed to write file " << filename;
+        throw(E(ss));
+    }
+}
+
+void PolicyAutomaton::Load(const string &filename)
+{
+    ifstream fp(filename.c_str(),ios::in | ios::binary);
+    if(!fp)
+    {
+        stringstream ss;
+        ss << "PolicyAutomaton::Load: failed to open file " << filename;
+        throw(E(ss));
+    }
+
+    char magic[sizeof(PolicyAutomaton_Magic)];
+    fp.read(magic,sizeof(magic));
+    if(!fp || string(magic,sizeof(magic))!=
+       string(PolicyAutomaton_Magic,sizeof(PolicyAutomaton_Magic)))
+    {
+        stringstream ss;
+        ss << "PolicyAutomaton::Load: " << filename
+           << " is not a PolicyAutomaton file";
+        throw(E(ss));
+    }
+
+    size_t nrAgents=ReadIndex(fp);
+    _m_actionNames.resize(nrAgents);
+    _m_observationNames.resize(nrAgents);
+    _m_actions.resize(nrAgents);
+    _m_successors.resize(nrAgents);
+    for(Index agentI=0;agentI!=nrAgents;++agentI)
+    {
+        _m_actionNames[agentI]=ReadNames(fp);
+        _m_observationNames[agentI]=ReadNames(fp);
+        _m_actions[agentI]=ReadIndices(fp);
+        _m_successors[agentI]=ReadIndices(fp);
+    }
+
+    CheckIntegrity();
+}
+
+string PolicyAutomaton::SoftPrint() const
+{
+    stringstream ss;
+    for(Index agentI=0;agentI!=GetNrAgents();++agentI)
+    {
+        ss << "Policy automaton for agent " << agentI << endl;
+        for(Index n=0;n!=GetNrNodes(agentI);++n)
+        {
+            ss << n << " " << GetActionName(agentI,GetAction(agentI,n))
+               << " ->";
+            for(Index oI=0;oI!=GetNrObservations(agentI);++oI)
+                ss << " " << GetObservationName(agentI,oI) << ":"
+                   << GetSuccessor(agentI,n,oI);
+            ss << endl;
+        }
+    }
+    return(ss.str());
+}
+
+void PolicyAutomaton::Print() const
+{
+    cout << SoftPrint();
+}
@@ -0,0 +1,138 @@
+/**\file PolicyAutomaton.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+/* Only include this header file once. */
+#ifndef _POLICYAUTOMATON_H_
+#define _POLICYAUTOMATON_H_ 1
+
+/* the include directives */
+#include <string>
+#include <vector>
+#include "Globals.h"
+
+class JointPolicyPureVector;
+class PlanningUnitMADPDiscrete;
+
+/**\brief PolicyAutomaton is a compact representation of the
+ * individual policies of a JointPolicyPureVector, meant for executing
+ * them in an external control loop.
+ *
+ * The policy of each agent is stored as an automaton over integer
+ * node ids: node n corresponds to the n-th observation history of
+ * the agent, and stores the action to take and, for each
+ * observation, the successor node. The nodes of the last stage have
+ * the root node 0 as successor, so execution can continue after the
+ * planning horizon. Action and observation names are stored as well,
+ * such that a controller can map its (named) events to indices once,
+ * after which each step is a single array lookup.
+ *
+ * A PolicyAutomaton can be written to and read from a binary file
+ * (in host byte order), so a controller does not need to parse the
+ * problem or plan at startup.
+ */
+class PolicyAutomaton 
+{
+private:    
+    /// For each agent, the names of its actions.
+    std::vector<std::vector<std::string> > _m_actionNames;
+    /// For each agent, the names of its observations.
+    std::vector<std::vector<std::string> > _m_observationNames;
+    /// For each agent, the action of each node.
+    std::vector<std::vector<Index> > _m_actions;
+    /// For each agent, the successor of node n for observation o at
+    /// index n*nrO+o.
+    std::vector<std::vector<Index> > _m_successors;
+
+    void CheckIntegrity() const;
+    /// Copies the action and observation names of the agents of \a pu.
+    void SetNames(const PlanningUnitMADPDiscrete &pu);
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructs an empty automaton, to be filled by Load().
+    PolicyAutomaton();
+    /// Compiles the individual policies of \a jpol for \a pu.
+    PolicyAutomaton(const JointPolicyPureVector &jpol,
+                    const PlanningUnitMADPDiscrete &pu);
+    /**\brief Constructs an automaton with the given nodes for \a pu.
+     *
+     * actions[agentI][n] is the action of node n, and
+     * successors[agentI][n*nrO+o] its successor for observation o. This
+     * allows planners that do not represent their policies over
+     * observation histories (such as MBDPPlanner) to store their
+     * policy trees directly.*/
+    PolicyAutomaton(const PlanningUnitMADPDiscrete &pu,
+                    const std::vector<std::vector<Index> > &actions,
+                    const std::vector<std::vector<Index> > &successors);
+
+    size_t GetNrAgents() const { return(_m_actions.size()); }
+    size_t GetNrNodes(Index agentI) const
+        { return(_m_actions[agentI].size()); }
+    size_t GetNrActions(Index agentI) const
+        { return(_m_actionNames[agentI].size()); }
+    size_t GetNrObservations(Index agentI) const
+        { return(_m_observationNames[agentI].size()); }
+
+    /// Returns the node in which each agent starts.
+    static Index GetRootNode() { return(0); }
+
+    /// Returns the action \a agentI takes in \a node.
+    Index GetAction(Index agentI, Index node) const
+        { return(_m_actions[agentI][node]); }
+
+    /// Returns the node \a agentI moves to after observing \a oI in \a node.
+    Index GetSuccessor(Index agentI, Index node, Index oI) const
+        { return(_m_successors[agentI][node*GetNrObservations(agentI)+oI]); }
+
+    const std::string& GetActionName(Index agentI, Index aI) const
+        { return(_m_actionNames[agentI][aI]); }
+    const std::string& GetObservationName(Index agentI, Index oI) const
+        { return(_m_observationNames[agentI][oI]); }
+
+    /// Returns the index of the action of \a agentI called \a name.
+    Index GetActionIndex(Index agentI, const std::string &name) const;
+    /// Returns the index of the observation of \a agentI called \a name.
+    Index GetObservationIndex(Index agentI, const std::string &name) const;
+
+    /// Writes the automaton to binary file \a filename.
+    void Save(const std::string &filename) const;
+    /// Reads the automaton from binary file \a filename.
+    void Load(const std::string &filename);
+
+    std::string SoftPrint() const;
+    void Print() const;
+};
+
+
+#endif /* !_POLICYAUTOMATON_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
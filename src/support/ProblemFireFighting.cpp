@@ -28,6 +28,9 @@
 
 #include "ProblemFireFighting.h"
 #include "IndexTools.h"
+#include "TwoStageDynamicBayesianNetwork.h"
+#include "TransitionModel2DBN.h"
+#include "ObservationModel2DBN.h"
 
 
 #define DEBUG_PFF 0
@@ -44,7 +47,7 @@ using namespace std;
 //Default constructor
 ProblemFireFighting::ProblemFireFighting(
         size_t nrAgents, size_t nrHouses, size_t nrFLs,
-        double costOfMove, bool forcePositionRepres)
+        double costOfMove, bool forcePositionRepres, bool factoredModel)
     :
         DecPOMDPDiscrete(
                 SoftPrintBriefDescription(nrAgents, nrHouses, nrFLs),
@@ -54,8 +57,12 @@ ProblemFireFighting::ProblemFireFighting(
         ,_m_nrAgents(nrAgents)
         ,_m_nrHouses(nrHouses)
         ,_m_nrFireLevels(nrFLs)
+        ,_m_factoredModel(factoredModel)
 {
     SetSparse(true);
+    // the number of joint actions and observations grows exponentially
+    // with the number of agents, only create the ones that are printed
+    SetLazyJointSpaces(true);
     SetNrAgents(nrAgents);
 
 
@@ -179,20 +186,35 @@ ProblemFireFighting::ProblemFireFighting(
 
     MADPComponentDiscreteObservations::SetInitialized(true);
 
-    // add the transition model
-    if(DEBUG_PFF) cout << ">>>Adding Transition model..."<<endl;
-    CreateNewTransitionModel();
-    FillTransitionModel();    
-
-    // add observation model
-    if(DEBUG_PFF) cout << ">>>Adding Observation model..."<<endl;
-    CreateNewObservationModel();
-    FillObservationModel();
-    MultiAgentDecisionProcessDiscrete::SetInitialized(true);
-
-    // add rewards
-    CreateNewRewardModel();
-    FillRewardModel();
+    if(_m_factoredModel)
+    {
+        // add the transition and observation model
+        if(DEBUG_PFF) cout << ">>>Adding 2DBN..."<<endl;
+        Fill2DBN();
+        MultiAgentDecisionProcessDiscrete::SetInitialized(true);
+
+        // add rewards
+        CreateNewRewardModel();
+        FillRewardModel(*dynamic_cast<const TransitionModel2DBN*>(
+                            GetTransitionModelDiscretePtr())->Get2DBN());
+    }
+    else
+    {
+        // add the transition model
+        if(DEBUG_PFF) cout << ">>>Adding Transition model..."<<endl;
+        CreateNewTransitionModel();
+        FillTransitionModel();    
+
+        // add observation model
+        if(DEBUG_PFF) cout << ">>>Adding Observation model..."<<endl;
+        CreateNewObservationModel();
+        FillObservationModel();
+        MultiAgentDecisionProcessDiscrete::SetInitialized(true);
+
+        // add rewards
+        CreateNewRewardModel();
+        FillRewardModel();
+    }
     if(DEBUG_PFF)     cout << "Model created..."<<endl; 
     DecPOMDPDiscrete::SetInitialized(true);
 }
@@ -388,94 +410,100 @@ double ProblemFireFighting::ComputeTransitionProb(
 #endif
         //this is dependent on s1 right?:
         bool neighborIsBurning = isNeighborBurning(s1, hI);
+        double p2 = ComputeHouseTransitionProb(curLevel, neighborIsBurning,
+                                               nrAgentsAtLocation, nextLevel);
+#if 0 && DEBUG_CTM
+        cout << "p=" << p << ", p2=" << p2;
+#endif
+        p *= p2;
+#if 0 && DEBUG_CTM
+        cout << ", new p=" << p << " - ";
+#endif
 
-        Index sameLevel = curLevel;
-        Index higherLevel = min((size_t)sameLevel+1, _m_nrFireLevels-1);
-        Index lowerLevel = (curLevel==0) ? 0 : (curLevel-1);
-        double p2=0.0;// the prob. factor of ThisHouseFirelevel;
-        switch(nrAgentsAtLocation)
+    }
+#if DEBUG_CTM
+    cout << "returning p=" << p << endl;
+#endif
+    return p;
+}
+
+double ProblemFireFighting::ComputeHouseTransitionProb(Index curLevel,
+        bool neighborIsBurning, size_t nrAgentsAtLocation,
+        Index nextLevel) const
+{
+    Index sameLevel = curLevel;
+    Index higherLevel = min((size_t)sameLevel+1, _m_nrFireLevels-1);
+    Index lowerLevel = (curLevel==0) ? 0 : (curLevel-1);
+    double p2=0.0;// the prob. factor of ThisHouseFirelevel;
+    switch(nrAgentsAtLocation)
+    {
+        case(0): 
         {
-            case(0): 
-            {
-                //this is kind of strange: when a house is not burning, but
-                //its neigbhor is, it will increase its FL with p=0.8
-                //but when it is already burning (and its neighbor is not), it 
-                //increase with p=0.6...
+            //this is kind of strange: when a house is not burning, but
+            //its neigbhor is, it will increase its FL with p=0.8
+            //but when it is already burning (and its neighbor is not), it 
+            //increase with p=0.6...
 
-                //fire is likely to increase
-                if(neighborIsBurning)
-                {
-                    if(nextLevel == sameLevel)
-                        p2+=0.2;
-                    if(nextLevel == higherLevel)
-                        p2+=0.8;
-                }
-                else if (curLevel == 0) //fire won't get ignited
-                {
-                    if(0 == nextLevel)
-                        p2=1.0;
-                    else //not possible so we can quit...
-                        p2=0.0;
-                }
-                else //normal burning house
-                {
-                    if(nextLevel == sameLevel)
-                        p2+=0.6;
-                    if(nextLevel == higherLevel)
-                        p2+=0.4;
-                }
-                break;
+            //fire is likely to increase
+            if(neighborIsBurning)
+            {
+                if(nextLevel == sameLevel)
+                    p2+=0.2;
+                if(nextLevel == higherLevel)
+                    p2+=0.8;
             }
-            case(1): 
+            else if (curLevel == 0) //fire won't get ignited
             {
-                //fire is likely to decrease
-                if(neighborIsBurning)
-                {
-                    if(nextLevel == sameLevel)
-                        p2+=0.4;
-                    if(nextLevel == lowerLevel) 
-                        p2+=0.6; //.6 prob of extuinguishing 1 fl
-                }
-                else if (curLevel == 0) //fire won't get ignited
-                {
-                    if(0 == nextLevel)
-                        p2=1.0;
-                    else //not possible so we can quit...
-                        p2=0.0;
-                }
-                else //normal burning house
-                {
-                    if(nextLevel == sameLevel)
-                        p2+=0.0;
-                    if(nextLevel == lowerLevel)
-                        p2+=1.0;
-                }
-                break;
+                if(0 == nextLevel)
+                    p2=1.0;
+                else //not possible so we can quit...
+                    p2=0.0;
+            }
+            else //normal burning house
+            {
+                if(nextLevel == sameLevel)
+                    p2+=0.6;
+                if(nextLevel == higherLevel)
+                    p2+=0.4;
             }
-            default: 
+            break;
+        }
+        case(1): 
+        {
+            //fire is likely to decrease
+            if(neighborIsBurning)
+            {
+                if(nextLevel == sameLevel)
+                    p2+=0.4;
+                if(nextLevel == lowerLevel) 
+                    p2+=0.6; //.6 prob of extuinguishing 1 fl
+            }
+            else if (curLevel == 0) //fire won't get ignited
             {
-                //more than 1 agent: fire is extinguished
                 if(0 == nextLevel)
                     p2=1.0;
                 else //not possible so we can quit...
                     p2=0.0;
             }
-
-            
+            else //normal burning house
+            {
+                if(nextLevel == sameLevel)
+                    p2+=0.0;
+                if(nextLevel == lowerLevel)
+                    p2+=1.0;
+            }
+            break;
+        }
+        default: 
+        {
+            //more than 1 agent: fire is extinguished
+            if(0 == nextLevel)
+                p2=1.0;
+            else //not possible so we can quit...
+                p2=0.0;
         }
-#if 0 && DEBUG_CTM
-        cout << "p=" << p << ", p2=" << p2;
-#endif
-        p *= p2;
-#if 0 && DEBUG_CTM
-        cout << ", new p=" << p << " - ";
-#endif
-
     }
-#if DEBUG_CTM
-    cout << "returning p=" << p << endl;
-#endif
-    return p;
+    return(p2);
 }
 
 bool ProblemFireFighting::isNeighborBurning( const std::vector< Index>& s, 
@@ -534,18 +562,7 @@ double ProblemFireFighting::ComputeObservationProb(
             FL = s1.at(hI);   //the firelevel at that house
         }
         //we compute P(FLAMES)
-        double pFlames = 0.0;
-        switch(FL)
-        {
-            case(0): //no fire
-                pFlames = 0.2; // 0.2 prob. of incorrectly observing
-                break;
-            case(1):
-                pFlames = 0.5;
-                break;
-            default:
-                pFlames = 0.8;
-        }
+        double pFlames = ComputeFlamesProb(FL);
         double pNoFlames = 1.0-pFlames;                 
         observation_t obsAgI = (observation_t) jo.at(agI);
         switch(obsAgI)
@@ -561,6 +578,128 @@ double ProblemFireFighting::ComputeObservationProb(
     }
     return p_jo;
 }
+double ProblemFireFighting::ComputeFlamesProb(Index FL)
+{
+    double pFlames = 0.0;
+    switch(FL)
+    {
+        case(0): //no fire
+            pFlames = 0.2; // 0.2 prob. of incorrectly observing
+            break;
+        case(1):
+            pFlames = 0.5;
+            break;
+        default:
+            pFlames = 0.8;
+    }
+    return(pFlames);
+}
+
+void ProblemFireFighting::Fill2DBN()
+{
+    vector<size_t> nrObservations(_m_nrAgents, 2);
+    boost::shared_ptr<TwoStageDynamicBayesianNetwork> dbn(
+        new TwoStageDynamicBayesianNetwork(_m_nrPerStateFeatureVec,
+                                           _m_nrActions, nrObservations));
+    vector<Index> allAgents;
+    for(Index agI=0; agI < _m_nrAgents; agI++)
+        allAgents.push_back(agI);
+
+    //the fire level of house hI depends on the fire levels of hI and its
+    //neighbors, and on the actions of all agents
+    for(Index hI=0; hI < _m_nrHouses; hI++)
+    {
+        vector<Index> XSoI;
+        if(hI > 0)
+            XSoI.push_back(hI-1);
+        XSoI.push_back(hI);
+        if(hI+1 < _m_nrHouses)
+            XSoI.push_back(hI+1);
+        dbn->SetScopeY(hI, XSoI, allAgents);
+
+        vector<size_t> domain = dbn->GetParentDomainY(hI);
+        vector<Index> parentVals(domain.size(), 0);
+        //the position of hI in XSoI
+        Index self = (hI > 0) ? 1 : 0;
+        do {
+            bool neighborIsBurning = false;
+            for(Index i=0; i < XSoI.size(); i++)
+                if(i != self && parentVals[i] > 0)
+                    neighborIsBurning = true;
+            size_t nrAgentsAtLocation = 0;
+            for(Index agI=0; agI < _m_nrAgents; agI++)
+                if(parentVals[XSoI.size() + agI] == hI)
+                    nrAgentsAtLocation++;
+            for(Index nextLevel=0; nextLevel < _m_nrFireLevels; nextLevel++)
+            {
+                double p = ComputeHouseTransitionProb(parentVals[self],
+                                                      neighborIsBurning,
+                                                      nrAgentsAtLocation,
+                                                      nextLevel);
+                if(p > 0.0)
+                    dbn->SetYProbability(hI, parentVals, nextLevel, p);
+            }
+        } while(!IndexTools::Increment(parentVals, domain));
+    }
+
+    //movements are deterministic: the position of an agent is the house
+    //it chose to go to
+    if(_m_includePositions)
+        for(Index agI=0; agI < _m_nrAgents; agI++)
+        {
+            Index y = _m_nrHouses + agI;
+            dbn->SetScopeY(y, vector<Index>(), vector<Index>(1, agI));
+            for(Index aI=0; aI < _m_nrHouses; aI++)
+                dbn->SetYProbability(y, vector<Index>(1, aI), aI, 1.0);
+        }
+
+    //an agent observes the fire level at the house it is at
+    for(Index agI=0; agI < _m_nrAgents; agI++)
+    {
+        vector<Index> YSoI;
+        for(Index hI=0; hI < _m_nrHouses; hI++)
+            YSoI.push_back(hI);
+        if(_m_includePositions)
+        {
+            YSoI.push_back(_m_nrHouses + agI);
+            dbn->SetScopeO(agI, YSoI, vector<Index>());
+        }
+        else
+            dbn->SetScopeO(agI, YSoI, vector<Index>(1, agI));
+
+        vector<size_t> domain = dbn->GetParentDomainO(agI);
+        vector<Index> parentVals(domain.size(), 0);
+        do {
+            //either the position or the action of agI
+            Index hI = parentVals[_m_nrHouses];
+            Index FL = (hI == _m_nrHouses) ? 0 : parentVals[hI];
+            double pFlames = ComputeFlamesProb(FL);
+            dbn->SetOProbability(agI, parentVals, FLAMES, pFlames);
+            dbn->SetOProbability(agI, parentVals, NOFLAMES, 1.0-pFlames);
+        } while(!IndexTools::Increment(parentVals, domain));
+    }
+
+    SetTransitionModelPtr(new TransitionModel2DBN(dbn));
+    SetObservationModelPtr(new ObservationModel2DBN(dbn));
+}
+
+void ProblemFireFighting::FillRewardModel(
+    const TwoStageDynamicBayesianNetwork& dbn)
+{
+    //the reward is minus the sum of the expected next fire levels, which
+    //only requires the marginals of the fire level factors
+    for(Index s1=0; s1<GetNrStates();s1++) 
+        for(Index ja=0; ja<GetNrJointActions(); ja++)
+        {
+            double r = 0.0;
+            for(Index hI = 0; hI < _m_nrHouses; hI++)
+                for(Index FL = 1; FL < _m_nrFireLevels; FL++)
+                    r -= FL * dbn.GetYProbability(hI, s1, ja, FL);
+            if(r != 0.0)
+                SetReward(s1, ja, r);
+        }
+}
+
 void ProblemFireFighting::FillRewardModel()
 {    
 
@@ -34,6 +34,8 @@
 #include "DecPOMDPDiscrete.h"
 #include "IndexTools.h"
 
+class TwoStageDynamicBayesianNetwork;
+
 /** \brief ProblemFireFighting is a class that represents 
  * the firefighting problem as described in #refGMAA (DOC-references.h).
  * */
@@ -45,6 +47,8 @@ class ProblemFireFighting : public DecPOMDPDiscrete
         size_t _m_nrHouses;
         size_t _m_nrFireLevels;
         bool _m_includePositions;
+        ///Whether the model is represented by a 2DBN (see Fill2DBN()).
+        bool _m_factoredModel;
 
         size_t _m_nrStateFeatures;
         //vector that stores the number of values per state feature.
@@ -64,6 +68,16 @@ class ProblemFireFighting : public DecPOMDPDiscrete
         void FillObservationModel();
         ///Fills the reward model with the  problem rewards.
         void FillRewardModel();
+        /**\brief Constructs a TwoStageDynamicBayesianNetwork and uses
+         * it as transition and observation model.
+         *
+         * The fire level of a house only depends on its own and its
+         * neighbors' fire levels, and the observation of an agent only
+         * on the fire levels (and its own action or position), so the
+         * CPTs are exponentially smaller than the flat models.*/
+        void Fill2DBN();
+        ///Fills the reward model R(s,ja) using the CPTs of dbn.
+        void FillRewardModel(const TwoStageDynamicBayesianNetwork& dbn);
     
         size_t NumberOfContainedStartPositions(const 
                 std::vector<Index>& state) const;
@@ -88,6 +102,12 @@ class ProblemFireFighting : public DecPOMDPDiscrete
                 const std::vector< Index>& jo
                 ) const;
         double ComputeReward(Index sI) const;
+        ///Returns P(nextLevel|curLevel,...) for a single house.
+        double ComputeHouseTransitionProb(Index curLevel,
+                bool neighborIsBurning, size_t nrAgentsAtLocation,
+                Index nextLevel) const;
+        ///Returns the probability of observing FLAMES at fire level FL.
+        static double ComputeFlamesProb(Index FL);
         //is a neighbor of house hI burning?
         static bool isNeighborBurning( const std::vector< Index>& s1, 
                 Index hI) ;
@@ -96,8 +116,12 @@ class ProblemFireFighting : public DecPOMDPDiscrete
     public:
         // Constructor, destructor and copy assignment.
         /// (default) Constructor
+        /** If factoredModel is set, the transition and observation
+         * model are represented by a TwoStageDynamicBayesianNetwork
+         * instead of (sparse) matrices, see Fill2DBN(). */
         ProblemFireFighting(size_t nrAgents, size_t nrHouses, size_t nrFLs,
-                double costOfMove=0.0, bool forcePositionRepres = false);
+                double costOfMove=0.0, bool forcePositionRepres = false,
+                bool factoredModel = false);
 };
 
 
@@ -34,7 +34,7 @@
 #include "QTableInterface.h"
 #include <boost/numeric/ublas/matrix.hpp>
 
-typedef boost::numeric::ublas::matrix<double> matrix_t;
+typedef boost::numeric::ublas::matrix<Scalar> matrix_t;
 
 /** \brief QTable implements QTableInterface using a full matrix. */
 class QTable
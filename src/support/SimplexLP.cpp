@@ -0,0 +1,146 @@
+/**\file SimplexLP.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+#include "SimplexLP.h"
+#include "E.h"
+
+using namespace std;
+
+/// Coefficients smaller than this are treated as zero when pivoting.
+static const double SIMPLEX_PIVOT_TOLERANCE=1e-11;
+
+SimplexLP::SimplexLP(size_t nrConstraints, size_t nrVariables) :
+    _m_nrConstraints(nrConstraints),
+    _m_nrVariables(nrVariables),
+    _m_A(nrConstraints*nrVariables,0.0),
+    _m_b(nrConstraints,0.0),
+    _m_c(nrVariables,0.0),
+    _m_x(nrVariables,0.0),
+    _m_objective(0),
+    _m_maxIterations(100*(nrConstraints+nrVariables)+1000)
+{
+}
+
+void SimplexLP::SetBound(Index i, double b)
+{
+    if(b<0)
+        throw(E("SimplexLP::SetBound right-hand side should be nonnegative"));
+    _m_b.at(i)=b;
+}
+
+SimplexLP::Status SimplexLP::Solve()
+{
+    size_t m=_m_nrConstraints,n=_m_nrVariables;
+
+    // the dictionary x_B(i) = b_i - sum_j a_ij x_N(j),
+    // z = z0 + sum_j c_j x_N(j), starting from the slack basis
+    vector<double> a(_m_A),b(_m_b),c(_m_c);
+    double z0=0;
+    vector<Index> basic(m),nonBasic(n);
+    for(Index j=0;j!=n;j++)
+        nonBasic[j]=j;
+    for(Index i=0;i!=m;i++)
+        basic[i]=n+i;
+
+    Status status=ITERATION_LIMIT;
+    for(size_t iter=0;iter!=_m_maxIterations;iter++)
+    {
+        // Bland's rule: the improving variable with the lowest index enters
+        size_t e=n;
+        for(Index j=0;j!=n;j++)
+            if(c[j]>SIMPLEX_PIVOT_TOLERANCE &&
+               (e==n || nonBasic[j]<nonBasic[e]))
+                e=j;
+        if(e==n)
+        {
+            status=OPTIMAL;
+            break;
+        }
+
+        // ratio test, ties go to the basic variable with the lowest index
+        size_t r=m;
+        double minRatio=0;
+        for(Index i=0;i!=m;i++)
+        {
+            double aie=a[i*n+e];
+            if(aie>SIMPLEX_PIVOT_TOLERANCE)
+            {
+                double ratio=b[i]/aie;
+                if(r==m || ratio<minRatio ||
+                   (ratio==minRatio && basic[i]<basic[r]))
+                {
+                    r=i;
+                    minRatio=ratio;
+                }
+            }
+        }
+        if(r==m)
+        {
+            status=UNBOUNDED;
+            break;
+        }
+
+        // pivot x_N(e) into the basis in place of x_B(r)
+        double *rowR=&a[r*n];
+        double piv=rowR[e];
+        b[r]/=piv;
+        for(Index j=0;j!=n;j++)
+            rowR[j]/=piv;
+        rowR[e]=1/piv;
+        for(Index i=0;i!=m;i++)
+        {
+            if(i==r)
+                continue;
+            double *rowI=&a[i*n];
+            double coef=rowI[e];
+            if(coef==0)
+                continue;
+            b[i]-=coef*b[r];
+            for(Index j=0;j!=n;j++)
+                rowI[j]-=coef*rowR[j];
+            rowI[e]=-coef*rowR[e];
+            // guard against round-off making the basis infeasible
+            if(b[i]<0)
+                b[i]=0;
+        }
+        double coef=c[e];
+        z0+=coef*b[r];
+        for(Index j=0;j!=n;j++)
+            c[j]-=coef*rowR[j];
+        c[e]=-coef*rowR[e];
+
+        swap(basic[r],nonBasic[e]);
+    }
+
+    fill(_m_x.begin(),_m_x.end(),0.0);
+    for(Index i=0;i!=m;i++)
+        if(basic[i]<n)
+            _m_x[basic[i]]=b[i];
+    _m_objective=z0;
+
+    return(status);
+}
@@ -0,0 +1,112 @@
+/**\file SimplexLP.h
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+/* Only include this header file once. */
+#ifndef _SIMPLEXLP_H_
+#define _SIMPLEXLP_H_ 1
+
+/* the include directives */
+#include <vector>
+#include "Globals.h"
+
+/**\brief SimplexLP is a small dense simplex solver for linear programs
+ * of the form max c'x subject to Ax <= b, x >= 0, with b >= 0.
+ *
+ * Because b >= 0 the origin is a feasible basic solution, so no first
+ * phase is needed. The dictionary only stores the m x n nonbasic
+ * columns, and Bland's rule is used to choose the entering and leaving
+ * variables, such that the (highly degenerate) LPs that arise when
+ * pruning alpha vectors cannot cycle.
+ *
+ * It is meant for the small LPs of AlphaVectorPruning, not as a
+ * general purpose LP solver. */
+class SimplexLP 
+{
+public:
+    /// The outcome of Solve().
+    enum Status { OPTIMAL, UNBOUNDED, ITERATION_LIMIT };
+
+private:    
+    
+    size_t _m_nrConstraints;
+    size_t _m_nrVariables;
+    /// The constraint matrix A, row major.
+    std::vector<double> _m_A;
+    /// The right-hand side b.
+    std::vector<double> _m_b;
+    /// The objective c.
+    std::vector<double> _m_c;
+
+    /// The solution found by the last call to Solve().
+    std::vector<double> _m_x;
+    double _m_objective;
+    size_t _m_maxIterations;
+
+protected:
+    
+public:
+    // Constructor, destructor and copy assignment.
+    /// Constructs an LP with all coefficients set to zero.
+    SimplexLP(size_t nrConstraints, size_t nrVariables);
+
+    /// Sets the objective coefficient of variable \a j.
+    void SetObjective(Index j, double c)
+        { _m_c.at(j)=c; }
+    /// Sets the coefficient of variable \a j in constraint \a i.
+    void SetConstraint(Index i, Index j, double a)
+        { _m_A.at(i*_m_nrVariables+j)=a; }
+    /// Sets the right-hand side of constraint \a i, which should be >= 0.
+    void SetBound(Index i, double b);
+    /// Sets the maximum number of pivots Solve() is allowed to do.
+    void SetMaxIterations(size_t n)
+        { _m_maxIterations=n; }
+
+    /**\brief Solves the LP.
+     *
+     * The coefficients are left untouched, so the LP can be modified
+     * and solved again. */
+    Status Solve();
+
+    /// Returns the objective value found by the last Solve().
+    double GetObjectiveValue() const
+        { return(_m_objective); }
+    /// Returns the value of variable \a j found by the last Solve().
+    double GetValue(Index j) const
+        { return(_m_x.at(j)); }
+
+    size_t GetNrConstraints() const
+        { return(_m_nrConstraints); }
+    size_t GetNrVariables() const
+        { return(_m_nrVariables); }
+};
+
+
+#endif /* !_SIMPLEXLP_H_ */
+
+// Local Variables: ***
+// mode:c++ ***
+// End: ***
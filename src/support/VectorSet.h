@@ -39,7 +39,7 @@
 
 
 /// Represents a set of (alpha) vectors.
-typedef boost::numeric::ublas::matrix<double> VectorSet;
+typedef boost::numeric::ublas::matrix<Scalar> VectorSet;
 
 typedef VectorSet::const_iterator1 VScit1;
 typedef VectorSet::iterator1 VSit1;
@@ -0,0 +1,129 @@
+/**\file compilePolicyAutomaton.cpp
+ *
+ * Authors:
+ * Frans Oliehoek <faolieho@science.uva.nl>
+ * Matthijs Spaan <mtjspaan@isr.ist.utl.pt>
+ *
+ * Copyright 2008 Universiteit van Amsterdam, Instituto Superior Tecnico
+ *
+ * This file is part of MultiAgentDecisionProcess.
+ *
+ * MultiAgentDecisionProcess is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * MultiAgentDecisionProcess is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with MultiAgentDecisionProcess.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * $Id: $
+ */
+
+
+#include <iostream>
+#include <time.h>
+#include "JESPDynamicProgrammingPlanner.h"
+#include "PolicyAutomaton.h"
+#include "directories.h"
+
+#include "argumentHandlers.h"
+#include "argumentUtils.h"
+
+using namespace std;
+using namespace ArgumentUtils;
+
+const char *argp_program_version = "compilePolicyAutomaton";
+
+// Program documentation
+static char doc[] =
+"compilePolicyAutomaton - plans with JESP and compiles the resulting \
+joint policy into a PolicyAutomaton file, which is read back and \
+checked against the joint policy \
+\v";
+
+//NOTE: make sure that the below value (nrChildParsers) is correct!
+const int nrChildParsers = 5;
+const struct argp_child childVector[] = {
+    ArgumentHandlers::problemFile_child,
+    ArgumentHandlers::globalOptions_child,
+    ArgumentHandlers::modelOptions_child,
+    ArgumentHandlers::solutionMethodOptions_child,
+    ArgumentHandlers::JESP_child,
+    { 0 }
+};
+
+#include "argumentHandlersPostChild.h"
+
+int main(int argc, char **argv)
+{
+    ArgumentHandlers::Arguments args;
+    argp_parse (&ArgumentHandlers::theArgpStruc, argc, argv, 0, 0, &args);
+
+    srand(time(0));
+
+    try {
+    DecPOMDPDiscreteInterface & decpomdp = * GetDecPOMDPDiscreteInterfaceFromArgs(args);
+
+    PlanningUnitMADPDiscreteParameters params;
+    params.SetComputeAll(true);
+    params.SetComputeJointActionObservationHistories(false);
+    params.SetComputeJointObservationHistories(false);
+    params.SetComputeJointBeliefs(false);
+    if(args.sparse)
+        params.SetUseSparseJointBeliefs(true);
+    else
+        params.SetUseSparseJointBeliefs(false);
+    JESPDynamicProgrammingPlanner jesp(params,args.horizon,&decpomdp);
+    jesp.SetNrRestarts(args.JESPnrRestarts);
+    jesp.Plan();
+    if(args.verbose >= 0)
+        cout << "value=" << jesp.GetExpectedReward() << endl;
+
+    const JointPolicyPureVector &jpol=*jesp.GetJointPolicyPureVector();
+    PolicyAutomaton compiled(jpol,jesp);
+
+    directories::MADPCreateResultsDir("JESP",decpomdp);
+    string filename=directories::MADPGetResultsFilename("JESP",decpomdp,args)
+        + "_PolicyAutomaton";
+    compiled.Save(filename);
+    if(args.verbose >= 0)
+        cout << "Wrote " << filename << endl;
+
+    PolicyAutomaton automaton;
+    automaton.Load(filename);
+    if(args.verbose >= 1)
+        automaton.Print();
+
+    // the automaton read back should execute exactly jpol
+    for(Index agentI=0;agentI!=jesp.GetNrAgents();++agentI)
+    {
+        if(automaton.GetNrNodes(agentI)!=
+           jesp.GetNrObservationHistories(agentI))
+            throw(E("compilePolicyAutomaton: wrong number of nodes"));
+        for(Index ohI=0;ohI!=jesp.GetNrObservationHistories(agentI);++ohI)
+        {
+            if(automaton.GetAction(agentI,ohI)!=
+               jpol.GetActionIndex(agentI,ohI))
+                throw(E("compilePolicyAutomaton: action mismatch"));
+            bool last=jesp.GetTimeStepForOHI(agentI,ohI)+1==args.horizon;
+            for(Index oI=0;oI!=jesp.GetNrObservations(agentI);++oI)
+                if(automaton.GetSuccessor(agentI,ohI,oI)!=
+                   (last ? PolicyAutomaton::GetRootNode() :
+                    jesp.GetSuccessorOHI(agentI,ohI,oI)))
+                    throw(E("compilePolicyAutomaton: successor mismatch"));
+        }
+    }
+    if(args.verbose >= 0)
+        cout << "PolicyAutomaton matches the joint policy" << endl;
+
+    }
+    catch(E& e){ e.Print(); return(1); }
+
+    return(0);
+}
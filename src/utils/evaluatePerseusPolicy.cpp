@@ -33,6 +33,7 @@
 #include "NullPlanner.h"
 #include "AgentPOMDP.h"
 #include "AgentBG.h"
+#include "JointBeliefTracker.h"
 #include "PerseusBackupType.h"
 #include "AlphaVectorBG.h"
 #include "Perseus.h"
@@ -117,6 +118,9 @@ int main(int argc, char **argv)
 
     SimulationDecPOMDPDiscrete sim(*np,args);
     SimulationResult result;
+    // all agents share their observations, so they can share the joint
+    // belief as well
+    JointBeliefTracker jbTracker(*np);
 
     switch(args.backup)
     {
@@ -128,7 +132,7 @@ int main(int argc, char **argv)
             new QAV<PerseusPOMDPPlanner>(*np,valueFunction.str());
         for(unsigned int i=0;i!=decpomdp->GetNrAgents();++i)
         {
-            agent1=new AgentPOMDP(*np,0,Qpomdp);
+            agent1=new AgentPOMDP(*np,0,Qpomdp,&jbTracker);
             agent1->SetIndex(i);
             agents.push_back(agent1);
         }
@@ -143,7 +147,7 @@ int main(int argc, char **argv)
         AgentDelayedSharedObservations *agent1;
         for(unsigned int i=0;i!=decpomdp->GetNrAgents();++i)
         {
-            agent1=new AgentBG(*np,0,Qbg);
+            agent1=new AgentBG(*np,0,Qbg,&jbTracker);
             agent1->SetIndex(i);
             agents.push_back(agent1);
         }